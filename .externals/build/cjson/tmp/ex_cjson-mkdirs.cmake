@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/.externals/build/cjson/src/ex_cjson"
+  "/root/repo/.externals/build/cjson/src/ex_cjson-build"
+  "/root/repo/.externals/build/cjson"
+  "/root/repo/.externals/build/cjson/tmp"
+  "/root/repo/.externals/build/cjson/src/ex_cjson-stamp"
+  "/root/repo/.externals/build/cjson/src"
+  "/root/repo/.externals/build/cjson/src/ex_cjson-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/.externals/build/cjson/src/ex_cjson-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/.externals/build/cjson/src/ex_cjson-stamp${cfgdir}") # cfgdir has leading slash
+endif()
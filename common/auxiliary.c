@@ -89,6 +89,16 @@ time_t tod_get_local_timezone(void)
   return _local_timezone;
 }
 
+int64_t tod_days_from_civil(int64_t y, int m, int d)
+{
+  y -= m <= 2;
+  int64_t era = (y >= 0 ? y : y - 399) / 400;
+  int64_t yoe = y - era * 400;
+  int64_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
 static void _get_local_time(struct timeval *tv0, struct tm *tm0)
 {
   gettimeofday(tv0, NULL);
@@ -369,6 +369,8 @@ const char *sql_conn_attr(SQLLEN v)
     CASE(SQL_ATTR_QUIET_MODE);
     CASE(SQL_ATTR_TXN_ISOLATION);
     CASE(SQL_ATTR_AUTOCOMMIT);
+    CASE(SQL_ATTR_TAOS_STMT_CACHE_HITS);
+    CASE(SQL_ATTR_TAOS_STMT_CACHE_MISSES);
     default:
     return "SQL_ATTR_unknown";
   }
@@ -484,6 +486,9 @@ const char *sql_stmt_attr(SQLULEN v)
     CASE(SQL_ATTR_SIMULATE_CURSOR);
     CASE(SQL_ATTR_USE_BOOKMARKS);
     CASE(SQL_ATTR_ROW_ARRAY_SIZE);
+    CASE(SQL_ATTR_TAOS_PIPELINED_INSERT);
+    CASE(SQL_ATTR_TAOS_INSERT_BATCH_ROWS);
+    CASE(SQL_ATTR_TAOS_CONTINUE_ON_ERROR);
     default:
     return "SQL_ATTR_unknown";
   }
@@ -144,15 +144,10 @@ int helper_get_tsdb_ws(int time_precision, const char *name, uint8_t col_type, c
   return 0;
 }
 
-int helper_get_tsdb(TAOS_RES *res, int block, TAOS_FIELD *fields, int time_precision, TAOS_ROW rows, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len)
+static int _helper_get_tsdb(TAOS_RES *res, int block, TAOS_FIELD *fields, int time_precision, TAOS_ROW rows, const int *offsets, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len)
 {
   TAOS_FIELD *field = fields + i_col;
 
-  if (CALL_taos_is_null(res, i_row, i_col)) {
-    tsdb->is_null = 1;
-    return 0;
-  }
-
   tsdb->is_null = 0;
 
   switch(field->type) {
@@ -228,7 +223,7 @@ int helper_get_tsdb(TAOS_RES *res, int block, TAOS_FIELD *fields, int time_preci
     case TSDB_DATA_TYPE_VARBINARY:
     case TSDB_DATA_TYPE_GEOMETRY:
       if (block) {
-        int *offsets = CALL_taos_get_column_data_offset(res, i_col);
+        if (!offsets) offsets = CALL_taos_get_column_data_offset(res, i_col);
         char *col = (char*)(rows[i_col]);
         col += offsets[i_row];
         int16_t length = *(int16_t*)col;
@@ -274,6 +269,27 @@ int helper_get_tsdb(TAOS_RES *res, int block, TAOS_FIELD *fields, int time_preci
   return 0;
 }
 
+int helper_get_tsdb(TAOS_RES *res, int block, TAOS_FIELD *fields, int time_precision, TAOS_ROW rows, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len)
+{
+  if (CALL_taos_is_null(res, i_row, i_col)) {
+    tsdb->is_null = 1;
+    return 0;
+  }
+
+  return _helper_get_tsdb(res, block, fields, time_precision, rows, NULL, i_row, i_col, tsdb, buf, len);
+}
+
+int helper_get_tsdb_in_block(TAOS_FIELD *fields, int time_precision, TAOS_ROW rows, const int *offsets, int is_null, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len)
+{
+  // NOTE: offsets is required for variable-length columns
+  if (is_null) {
+    tsdb->is_null = 1;
+    return 0;
+  }
+
+  return _helper_get_tsdb(NULL, 1, fields, time_precision, rows, offsets, i_row, i_col, tsdb, buf, len);
+}
+
 
 #ifdef FAKE_TAOS
 void taos_cleanup(void)
@@ -551,6 +567,16 @@ bool taos_is_null(TAOS_RES *res, int32_t row, int32_t col)
   return 0;
 }
 
+int taos_is_null_by_column(TAOS_RES *res, int columnIndex, bool result[], int *rows)
+{
+  (void)res;
+  (void)columnIndex;
+  // NOTE: consistent with taos_is_null, *rows is the number of rows of the current block, as passed in
+  if (!result || !rows || *rows < 0) return -1;
+  for (int i = 0; i < *rows; ++i) result[i] = 0;
+  return 0;
+}
+
 bool taos_is_update_query(TAOS_RES *res)
 {
   (void)res;
@@ -644,9 +670,7 @@ void taos_query_a(TAOS *taos, const char *sql, __taos_async_fn_t fp, void *param
 
 void taos_fetch_rows_a(TAOS_RES *res, __taos_async_fn_t fp, void *param)
 {
-  (void)res;
-  (void)fp;
-  (void)param;
+  if (fp) fp(param, res, 0);
 }
 
 void taos_fetch_raw_block_a(TAOS_RES *res, __taos_async_fn_t fp, void *param)
@@ -29,6 +29,35 @@
 
 #include <sqlext.h>
 
+#ifndef SQL_DRIVER_STMT_ATTR_BASE
+#define SQL_DRIVER_STMT_ATTR_BASE          0x00004000
+#endif
+
+// NOTE: driver-specific statement attributes
+#define SQL_ATTR_TAOS_PIPELINED_INSERT     (SQL_DRIVER_STMT_ATTR_BASE + 1)
+#define SQL_TAOS_PIPELINED_INSERT_OFF      0UL
+#define SQL_TAOS_PIPELINED_INSERT_ON       1UL
+// NOTE: read-only, number of rows in the last insert batch sent
+#define SQL_ATTR_TAOS_INSERT_BATCH_ROWS    (SQL_DRIVER_STMT_ATTR_BASE + 2)
+// NOTE: rows failing conversion are marked SQL_PARAM_ERROR and left out, the rest of the batch is still sent
+#define SQL_ATTR_TAOS_CONTINUE_ON_ERROR    (SQL_DRIVER_STMT_ATTR_BASE + 3)
+#define SQL_TAOS_CONTINUE_ON_ERROR_OFF     0UL
+#define SQL_TAOS_CONTINUE_ON_ERROR_ON      1UL
+
+#ifndef SQL_DRIVER_CONN_ATTR_BASE
+#define SQL_DRIVER_CONN_ATTR_BASE          0x00004000
+#endif
+
+// NOTE: driver-specific connection attributes, read-only, SQLULEN counters of STMT_CACHE lookups by prepared inserts
+#define SQL_ATTR_TAOS_STMT_CACHE_HITS      (SQL_DRIVER_CONN_ATTR_BASE + 1)
+#define SQL_ATTR_TAOS_STMT_CACHE_MISSES    (SQL_DRIVER_CONN_ATTR_BASE + 2)
+// NOTE: SQLULEN counters of CONN_POOL lookups, environment-wide, a handle discarded by validation counts as a miss
+#define SQL_ATTR_TAOS_CONN_POOL_HITS       (SQL_DRIVER_CONN_ATTR_BASE + 3)
+#define SQL_ATTR_TAOS_CONN_POOL_MISSES     (SQL_DRIVER_CONN_ATTR_BASE + 4)
+// NOTE: SQLULEN counters of META_CACHE_TTL lookups, process-wide, connections without META_CACHE_TTL never look up
+#define SQL_ATTR_TAOS_META_CACHE_HITS      (SQL_DRIVER_CONN_ATTR_BASE + 5)
+#define SQL_ATTR_TAOS_META_CACHE_MISSES    (SQL_DRIVER_CONN_ATTR_BASE + 6)
+
 EXTERN_C_BEGIN
 
 const char *sqlc_data_type(SQLLEN v) FA_HIDDEN;
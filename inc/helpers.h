@@ -47,6 +47,8 @@ const char *tod_strptime(const char *s, const char *format, struct tm *tm) FA_HI
 const char *tod_strptime_with_len(const char *s, size_t len, const char *fmt, struct tm *tm) FA_HIDDEN;
 // NOTE: eg.: +28800 for Beijing +0800/+08:00
 time_t tod_get_local_timezone(void) FA_HIDDEN;
+// NOTE: proleptic gregorian calendar, days since 1970-01-01, `m` and `d` 1-based
+int64_t tod_days_from_civil(int64_t y, int m, int d) FA_HIDDEN;
 uintptr_t tod_get_current_thread_id(void) FA_HIDDEN;
 uintptr_t tod_get_current_process_id(void) FA_HIDDEN;
 const char* tod_get_format_current_local_timestamp_ms(char *s, size_t n) FA_HIDDEN;
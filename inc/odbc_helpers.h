@@ -408,6 +408,16 @@ static inline SQLRETURN call_SQLCloseCursor(const char *file, int line, const ch
   return sr;
 }
 
+static inline SQLRETURN call_SQLCancel(const char *file, int line, const char *func,
+    SQLHSTMT StatementHandle)
+{
+  LOGD_ODBC(file, line, func, "SQLCancel(StatementHandle:%p) ...", StatementHandle);
+  SQLRETURN sr = SQLCancel(StatementHandle);
+  diag(sr, SQL_HANDLE_STMT, StatementHandle);
+  LOGD_ODBC(file, line, func, "SQLCancel(StatementHandle:%p) => %s", StatementHandle, sql_return_type(sr));
+  return sr;
+}
+
 static inline SQLRETURN call_SQLSetConnectAttr(const char *file, int line, const char *func,
     SQLHDBC ConnectionHandle, SQLINTEGER Attribute, SQLPOINTER ValuePtr, SQLINTEGER StringLength)
 {
@@ -672,6 +682,7 @@ static inline SQLRETURN call_SQLRowCount(const char *file, int line, const char
 #define CALL_SQLEndTran(...)                       call_SQLEndTran(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_SQLFreeStmt(...)                      call_SQLFreeStmt(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_SQLCloseCursor(...)                   call_SQLCloseCursor(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
+#define CALL_SQLCancel(...)                        call_SQLCancel(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_SQLSetConnectAttr(...)                call_SQLSetConnectAttr(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_SQLBindCol(...)                       call_SQLBindCol(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_SQLDescribeColW(...)                  call_SQLDescribeColW(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
@@ -80,6 +80,18 @@ static inline LONG atomic_load(atomic_int *obj)
 #endif                   /* } */
 #endif                   /* } */
 
+#ifdef _WIN32            /* { */
+#define TOD_THREAD_LOCAL   __declspec(thread)
+#else                    /* }{ */
+#define TOD_THREAD_LOCAL   __thread
+#endif                   /* } */
+
+#ifdef _WIN32            /* { */
+#define tod_fseeki64   _fseeki64
+#else                    /* }{ */
+#define tod_fseeki64   fseeko
+#endif                   /* } */
+
 #ifdef _WIN32            /* { */
 char* tod_getenv(const char *name);
 int tod_setenv(const char *name, const char *value, int overwrite);
@@ -92,6 +104,23 @@ int tod_setenv(const char *name, const char *value, int overwrite);
 typedef INIT_ONCE pthread_once_t;
 #define PTHREAD_ONCE_INIT INIT_ONCE_STATIC_INIT
 int pthread_once(pthread_once_t *once_control, void (*init_routine)(void));
+
+typedef SRWLOCK pthread_mutex_t;
+typedef CONDITION_VARIABLE pthread_cond_t;
+int pthread_mutex_init(pthread_mutex_t *mutex, const void *attr);
+int pthread_mutex_destroy(pthread_mutex_t *mutex);
+int pthread_mutex_lock(pthread_mutex_t *mutex);
+int pthread_mutex_unlock(pthread_mutex_t *mutex);
+int pthread_cond_init(pthread_cond_t *cond, const void *attr);
+int pthread_cond_destroy(pthread_cond_t *cond);
+int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex);
+int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime);
+int pthread_cond_signal(pthread_cond_t *cond);
+int pthread_cond_broadcast(pthread_cond_t *cond);
+
+typedef HANDLE pthread_t;
+int pthread_create(pthread_t *thread, const void *attr, void *(*start_routine)(void*), void *arg);
+int pthread_join(pthread_t thread, void **retval);
 #else                    /* }{ */
 #include <pthread.h>
 #endif                   /* } */
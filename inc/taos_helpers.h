@@ -432,6 +432,15 @@ static inline bool call_taos_is_null(const char *file, int line, const char *fun
   return b;
 }
 
+static inline int call_taos_is_null_by_column(const char *file, int line, const char *func, TAOS_RES *res, int columnIndex, bool result[], int *rows)
+{
+  LOGD_TAOS(file, line, func, "taos_is_null_by_column(res:%p,columnIndex:%d,result:%p,rows:%p(%d)) ...", res, columnIndex, result, rows, rows ? *rows : 0);
+  int r = taos_is_null_by_column(res, columnIndex, result, rows);
+  if (r) diag_res(res);
+  LOGD_TAOS(file, line, func, "taos_is_null_by_column(res:%p,columnIndex:%d,result:%p,rows:%p(%d)) => %d", res, columnIndex, result, rows, rows ? *rows : 0, r);
+  return r;
+}
+
 static inline bool call_taos_is_update_query(const char *file, int line, const char *func, TAOS_RES *res)
 {
   LOGD_TAOS(file, line, func, "taos_is_update_query(res:%p) ...", res);
@@ -858,6 +867,7 @@ static inline int call_taos_get_current_db(const char *file, int line, const cha
 #define CALL_taos_print_row(...) call_taos_print_row(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_taos_stop_query(...) call_taos_stop_query(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_taos_is_null(...) call_taos_is_null(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
+#define CALL_taos_is_null_by_column(...) call_taos_is_null_by_column(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_taos_is_update_query(...) call_taos_is_update_query(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_taos_fetch_block(...) call_taos_fetch_block(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
 #define CALL_taos_fetch_block_s(...) call_taos_fetch_block_s(__FILE__, __LINE__, __func__, ##__VA_ARGS__)
@@ -966,6 +976,8 @@ struct tsdb_data_s {
 
 int helper_get_tsdb(TAOS_RES *res, int block, TAOS_FIELD *fields, int time_precision, TAOS_ROW rows, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len) FA_HIDDEN;
 
+int helper_get_tsdb_in_block(TAOS_FIELD *fields, int time_precision, TAOS_ROW rows, const int *offsets, int is_null, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len) FA_HIDDEN;
+
 int helper_get_tsdb_ws(int time_precision, const char *name, uint8_t col_type, const void *col_data, uint32_t col_len, int i_row, int i_col, tsdb_data_t *tsdb, char *buf, size_t len) FA_HIDDEN;
 
 EXTERN_C_END
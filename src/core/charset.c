@@ -29,6 +29,11 @@
 
 #include <errno.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)     /* { */
+#define CHARSET_USE_SSE2
+#include <emmintrin.h>
+#endif                                                                                    /* } */
+
 iconv_t charset_conv_get(charset_conv_t *cnv)
 {
   return cnv->cnv;
@@ -66,6 +71,127 @@ size_t iconv_x(const char *file, int line, const char *func,
   return n;
 }
 
+int charset_is_utf8(const char *charset)
+{
+  if (!charset) return 0;
+  return tod_strcasecmp(charset, "UTF-8") == 0 || tod_strcasecmp(charset, "UTF8") == 0;
+}
+
+static size_t _utf8_ascii_to_utf16le(const unsigned char *s, size_t n, unsigned char *d)
+{
+  // NOTE: widens the leading ascii run, 16 or 8 bytes at a time, returns the number of bytes consumed
+  size_t i = 0;
+#ifdef CHARSET_USE_SSE2                  /* { */
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+    if (_mm_movemask_epi8(v)) break;
+    _mm_storeu_si128((__m128i*)(d + i * 2),      _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128((__m128i*)(d + i * 2 + 16), _mm_unpackhi_epi8(v, zero));
+  }
+#endif                                   /* } */
+  for (; i + 8 <= n; i += 8) {
+    uint64_t v;
+    memcpy(&v, s + i, sizeof(v));
+    if (v & 0x8080808080808080ULL) break;
+    for (size_t j = 0; j < 8; ++j) {
+      d[(i + j) * 2]     = s[i + j];
+      d[(i + j) * 2 + 1] = 0;
+    }
+  }
+  return i;
+}
+
+static int _utf8_decode(const unsigned char *s, size_t n, uint32_t *cp)
+{
+  // NOTE: returns the length of the leading character, or -1 if it's not well-formed
+  unsigned char c = s[0];
+  if (c < 0x80) { *cp = c; return 1; }
+  if (c < 0xc2) return -1;
+  if (c < 0xe0) {
+    if (n < 2 || (s[1] & 0xc0) != 0x80) return -1;
+    *cp = ((uint32_t)(c & 0x1f) << 6) | (s[1] & 0x3f);
+    return 2;
+  }
+  if (c < 0xf0) {
+    if (n < 3 || (s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80) return -1;
+    uint32_t v = ((uint32_t)(c & 0x0f) << 12) | ((uint32_t)(s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+    if (v < 0x800 || (v >= 0xd800 && v <= 0xdfff)) return -1;
+    *cp = v;
+    return 3;
+  }
+  if (c < 0xf5) {
+    if (n < 4 || (s[1] & 0xc0) != 0x80 || (s[2] & 0xc0) != 0x80 || (s[3] & 0xc0) != 0x80) return -1;
+    uint32_t v = ((uint32_t)(c & 0x07) << 18) | ((uint32_t)(s[1] & 0x3f) << 12) | ((uint32_t)(s[2] & 0x3f) << 6) | (s[3] & 0x3f);
+    if (v < 0x10000 || v > 0x10ffff) return -1;
+    *cp = v;
+    return 4;
+  }
+  return -1;
+}
+
+int charset_utf8_to_utf16le(const char **in, size_t *inlen, char **out, size_t *outlen)
+{
+  const unsigned char *s = (const unsigned char*)*in;
+  size_t               n = *inlen;
+  unsigned char       *d = (unsigned char*)*out;
+  size_t               m = *outlen;
+  int                  r = 0;
+
+  while (n) {
+    size_t nr = _utf8_ascii_to_utf16le(s, (n < m / 2) ? n : m / 2, d);
+    s += nr; n -= nr;
+    d += nr * 2; m -= nr * 2;
+    if (!n) break;
+
+    uint32_t cp;
+    int len = _utf8_decode(s, n, &cp);
+    if (len < 0) { r = -1; break; }
+    size_t bytes = (cp < 0x10000) ? 2 : 4;
+    if (bytes > m) { r = 1; break; }
+
+    if (cp < 0x10000) {
+      d[0] = (unsigned char)(cp & 0xff);
+      d[1] = (unsigned char)(cp >> 8);
+    } else {
+      uint32_t v  = cp - 0x10000;
+      uint16_t hi = (uint16_t)(0xd800 | (v >> 10));
+      uint16_t lo = (uint16_t)(0xdc00 | (v & 0x3ff));
+      d[0] = (unsigned char)(hi & 0xff);
+      d[1] = (unsigned char)(hi >> 8);
+      d[2] = (unsigned char)(lo & 0xff);
+      d[3] = (unsigned char)(lo >> 8);
+    }
+    s += len; n -= len;
+    d += bytes; m -= bytes;
+  }
+
+  *in     = (const char*)s;
+  *inlen  = n;
+  *out    = (char*)d;
+  *outlen = m;
+  return r;
+}
+
+int charset_utf8_utf16le_bytes(const char *s, size_t n, size_t *bytes)
+{
+  const unsigned char *p = (const unsigned char*)s;
+  size_t               v = 0;
+  while (n) {
+    uint32_t cp;
+    if (*p < 0x80) {
+      ++p; --n; v += 2;
+      continue;
+    }
+    int len = _utf8_decode(p, n, &cp);
+    if (len < 0) return -1;
+    p += len; n -= len;
+    v += (cp < 0x10000) ? 2 : 4;
+  }
+  *bytes = v;
+  return 0;
+}
+
 void charset_conv_release(charset_conv_t *cnv)
 {
   if (!cnv) return;
@@ -38,9 +38,11 @@
 #include "taosws_helpers.h"
 #endif                       /* } */
 #include "tls.h"
+#include "tsdb.h"
 #include "ts_parser.h"
 #include "url_parser.h"
 
+#include <ctype.h>
 #include <odbcinst.h>
 #include <string.h>
 
@@ -128,6 +130,8 @@ static void _conn_release_information_schema_ins_configs(conn_t *conn)
   TOD_SAFE_FREE(conn->s_charset);
   conn->sqlc_charset[0] = '\0';
   conn->tsdb_charset[0] = '\0';
+  conn->configs_loaded  = 0;
+  conn->tz_loaded       = 0;
 }
 
 static void _conn_release(conn_t *conn)
@@ -146,6 +150,11 @@ static void _conn_release(conn_t *conn)
 
   errs_release(&conn->errs);
 
+  tsdb_prepared_cache_release(&conn->prepared_cache);
+  TOD_SAFE_FREE(conn->pool_key);
+
+  pthread_mutex_destroy(&conn->shards_mutex);
+
   return;
 }
 
@@ -157,6 +166,19 @@ conn_t* conn_create(env_t *env)
     return NULL;
   }
 
+  if (tsdb_prepared_cache_init(&conn->prepared_cache)) {
+    env_oom(env);
+    free(conn);
+    return NULL;
+  }
+
+  if (pthread_mutex_init(&conn->shards_mutex, NULL)) {
+    env_oom(env);
+    tsdb_prepared_cache_release(&conn->prepared_cache);
+    free(conn);
+    return NULL;
+  }
+
   _conn_init(conn, env);
 
   return conn;
@@ -336,7 +358,8 @@ static SQLRETURN _conn_get_configs_from_information_schema_ins_configs(conn_t *c
 static int _conn_setup_iconvs(conn_t *conn)
 {
   // FIXME: we know conn->s_charset is actually server-side config rather than client-side
-  const char *tsdb_charset = conn->s_charset;
+  // NOTE: s_charset is not yet loaded under LAZY_INIT, see conn_get_tsdb_charset
+  const char *tsdb_charset = conn->s_charset ? conn->s_charset : "";
   const char *sqlc_charset = tod_get_sqlc_charset();
   if (!sqlc_charset) {
     conn_append_err_format(conn, "HY000", 0, "General error:current locale_or_ACP [%s]:not implemented yet", tod_get_locale_or_ACP());
@@ -467,6 +490,188 @@ static SQLRETURN _conn_get_server_info(conn_t *conn)
   return SQL_SUCCESS;
 }
 
+static int _conn_key_append(mem_t *mem, const char *s, int lower)
+{
+  size_t n = s ? strlen(s) : 0;
+  if (mem_keep(mem, mem->nr + n + 2)) return -1;
+  char *p = (char*)mem->base + mem->nr;
+  for (size_t i=0; i<n; ++i) {
+    p[i] = lower ? (char)tolower((unsigned char)s[i]) : s[i];
+  }
+  // NOTE: unit-separator, which is not expected in any connection attribute
+  p[n]   = '\x1f';
+  p[n+1] = '\0';
+  mem->nr += n + 1;
+  return 0;
+}
+
+static int64_t _conn_clock_seconds(void)
+{
+#ifdef _WIN32               /* { */
+  return (int64_t)(GetTickCount64() / 1000);
+#else                       /* }{ */
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec;
+#endif                      /* } */
+}
+
+// NOTE: see META_CACHE_TTL, process-wide, entries are refreshed in place and live till process exit
+static pthread_once_t           _meta_once;
+static pthread_mutex_t          _meta_mutex;
+static struct tod_list_head     _meta_entries;
+static size_t                   _meta_hits;
+static size_t                   _meta_misses;
+
+static void _conn_meta_init_once(void)
+{
+  pthread_mutex_init(&_meta_mutex, NULL);
+  INIT_TOD_LIST_HEAD(&_meta_entries);
+}
+
+static char* _conn_meta_key(conn_t *conn)
+{
+  const conn_cfg_t *cfg = &conn->cfg;
+  char port[16];
+  snprintf(port, sizeof(port), "%d", cfg->port);
+
+  mem_t mem = {0};
+  int r = 0;
+  if (!r) r = _conn_key_append(&mem, cfg->url ? "ws" : "native", 0);
+  if (!r) r = _conn_key_append(&mem, cfg->url, 0);
+  if (!r) r = _conn_key_append(&mem, cfg->ip, 1);
+  if (!r) r = _conn_key_append(&mem, port, 0);
+  if (r) {
+    mem_release(&mem);
+    return NULL;
+  }
+
+  return (char*)mem.base;
+}
+
+static conn_meta_t* _conn_meta_find(const char *key)
+{
+  conn_meta_t *p;
+  tod_list_for_each_entry(p, &_meta_entries, conn_meta_t, node) {
+    if (strcmp(p->key, key) == 0) return p;
+  }
+  return NULL;
+}
+
+static int _conn_meta_dup(char **dst, const char *src)
+{
+  char *s = NULL;
+  if (src) {
+    s = strdup(src);
+    if (!s) return -1;
+  }
+  TOD_SAFE_FREE(*dst);
+  *dst = s;
+  return 0;
+}
+
+static int _conn_meta_cache_load(conn_t *conn)
+{
+  if (!conn->cfg.meta_cache_ttl) return 0;
+
+  pthread_once(&_meta_once, _conn_meta_init_once);
+
+  char *key = _conn_meta_key(conn);
+  if (!key) return 0;
+
+  int hit = 0;
+  int64_t now = _conn_clock_seconds();
+
+  pthread_mutex_lock(&_meta_mutex);
+  conn_meta_t *meta = _conn_meta_find(key);
+  if (meta && now < meta->expire) {
+    int r = 0;
+    if (!r) r = _conn_meta_dup(&conn->s_statusInterval, meta->s_statusInterval);
+    if (!r) r = _conn_meta_dup(&conn->s_timezone,       meta->s_timezone);
+    if (!r) r = _conn_meta_dup(&conn->s_locale,         meta->s_locale);
+    if (!r) r = _conn_meta_dup(&conn->s_charset,        meta->s_charset);
+    if (!r) {
+      conn->tz         = meta->tz;
+      conn->tz_seconds = meta->tz_seconds;
+      hit = 1;
+    }
+  }
+  if (hit) _meta_hits   += 1;
+  else     _meta_misses += 1;
+  pthread_mutex_unlock(&_meta_mutex);
+
+  free(key);
+  return hit;
+}
+
+static void _conn_meta_cache_save(conn_t *conn)
+{
+  if (!conn->cfg.meta_cache_ttl) return;
+
+  pthread_once(&_meta_once, _conn_meta_init_once);
+
+  char *key = _conn_meta_key(conn);
+  if (!key) return;
+
+  pthread_mutex_lock(&_meta_mutex);
+  conn_meta_t *meta = _conn_meta_find(key);
+  if (!meta) {
+    meta = (conn_meta_t*)calloc(1, sizeof(*meta));
+    if (meta) {
+      meta->key = key;
+      key = NULL;
+      tod_list_add(&meta->node, &_meta_entries);
+    }
+  }
+  if (meta) {
+    int r = 0;
+    if (!r) r = _conn_meta_dup(&meta->s_statusInterval, conn->s_statusInterval);
+    if (!r) r = _conn_meta_dup(&meta->s_timezone,       conn->s_timezone);
+    if (!r) r = _conn_meta_dup(&meta->s_locale,         conn->s_locale);
+    if (!r) r = _conn_meta_dup(&meta->s_charset,        conn->s_charset);
+    meta->tz         = conn->tz;
+    meta->tz_seconds = conn->tz_seconds;
+    // NOTE: a partially refreshed entry is left expired
+    meta->expire     = r ? 0 : _conn_clock_seconds() + conn->cfg.meta_cache_ttl;
+  }
+  pthread_mutex_unlock(&_meta_mutex);
+
+  TOD_SAFE_FREE(key);
+}
+
+static int _conn_load_configs(conn_t *conn)
+{
+  int r = 0;
+
+  if (conn->configs_loaded) return 0;
+
+  if (_conn_meta_cache_load(conn)) {
+    conn->tz_loaded = 1;
+  } else {
+    SQLRETURN sr = _conn_get_configs_from_information_schema_ins_configs(conn);
+    if (sr == SQL_ERROR) return -1;
+  }
+  r = _conn_setup_iconvs(conn);
+  if (r) return -1;
+
+  conn->configs_loaded = 1;
+  return 0;
+}
+
+static int _conn_load_timezone(conn_t *conn)
+{
+  int r = 0;
+
+  if (conn->tz_loaded) return 0;
+
+  r = _conn_get_timezone(conn);
+  if (r) return -1;
+
+  conn->tz_loaded = 1;
+  if (conn->configs_loaded) _conn_meta_cache_save(conn);
+  return 0;
+}
+
 static SQLRETURN _conn_post_connected(conn_t *conn)
 {
   int r = 0;
@@ -475,11 +680,12 @@ static SQLRETURN _conn_post_connected(conn_t *conn)
   sr = _conn_get_server_info(conn);
   if (sr != SQL_SUCCESS) return SQL_ERROR;
 
-  sr = _conn_get_configs_from_information_schema_ins_configs(conn);
-  if (sr == SQL_ERROR) return SQL_ERROR;
-  r = _conn_setup_iconvs(conn);
-  if (r) return SQL_ERROR;
-  r = _conn_get_timezone(conn);
+  if (conn->cfg.lazy_init) {
+    r = _conn_setup_iconvs(conn);
+  } else {
+    r = _conn_load_configs(conn);
+    if (!r) r = _conn_load_timezone(conn);
+  }
   if (r) return SQL_ERROR;
   if (0) {
     r = tls_leakage_potential();
@@ -525,12 +731,279 @@ static SQLRETURN _conn_post_connected(conn_t *conn)
   return SQL_SUCCESS;
 }
 
+// NOTE: idle connections kept per key when CONN_POOL is not set but SQL_ATTR_CONNECTION_POOLING is enabled on env
+#define CONN_POOL_DEFAULT         8
+#define CONN_POOL_IDLE_TTL        60            // NOTE: in seconds, idle handles older than this are closed rather than reused
+
+static void _conn_pooled_free(conn_pooled_t *pooled)
+{
+  if (pooled->taos) {
+#ifdef HAVE_TAOSWS           /* { */
+    if (pooled->ws) CALL_ws_close((WS_TAOS*)pooled->taos);
+    else            CALL_taos_close((TAOS*)pooled->taos);
+#else                        /* }{ */
+    CALL_taos_close((TAOS*)pooled->taos);
+#endif                       /* } */
+    pooled->taos = NULL;
+  }
+  TOD_SAFE_FREE(pooled->key);
+  TOD_SAFE_FREE(pooled->s_statusInterval);
+  TOD_SAFE_FREE(pooled->s_timezone);
+  TOD_SAFE_FREE(pooled->s_locale);
+  TOD_SAFE_FREE(pooled->s_charset);
+  free(pooled);
+}
+
+int conn_pool_init(conn_pool_t *pool)
+{
+  INIT_TOD_LIST_HEAD(&pool->idles);
+  pool->nr     = 0;
+  pool->hits   = 0;
+  pool->misses = 0;
+
+  return pthread_mutex_init(&pool->mutex, NULL);
+}
+
+void conn_pool_release(conn_pool_t *pool)
+{
+  conn_pooled_t *p, *n;
+
+  pthread_mutex_lock(&pool->mutex);
+  tod_list_for_each_entry_safe(p, n, &pool->idles, conn_pooled_t, node) {
+    tod_list_del(&p->node);
+    _conn_pooled_free(p);
+  }
+  pool->nr = 0;
+  pthread_mutex_unlock(&pool->mutex);
+
+  pthread_mutex_destroy(&pool->mutex);
+}
+
+static size_t _conn_pool_size(conn_t *conn)
+{
+  if (conn->cfg.conn_pool) return conn->cfg.conn_pool;
+  if (conn->env->connection_pooling) return CONN_POOL_DEFAULT; // NOTE: SQL_CP_OFF is 0
+  return 0;
+}
+
+static char* _conn_pool_key(conn_t *conn)
+{
+  const conn_cfg_t *cfg = &conn->cfg;
+  char port[16];
+  snprintf(port, sizeof(port), "%d", cfg->port);
+
+  // NOTE: host and db are case-insensitive, whereas uid/pwd are not
+  mem_t mem = {0};
+  int r = 0;
+  if (!r) r = _conn_key_append(&mem, cfg->url ? "ws" : "native", 0);
+  if (!r) r = _conn_key_append(&mem, cfg->url, 0);
+  if (!r) r = _conn_key_append(&mem, cfg->ip, 1);
+  if (!r) r = _conn_key_append(&mem, port, 0);
+  if (!r) r = _conn_key_append(&mem, cfg->uid, 0);
+  if (!r) r = _conn_key_append(&mem, cfg->pwd, 0);
+  if (!r) r = _conn_key_append(&mem, cfg->db, 1);
+  if (!r) r = _conn_key_append(&mem, cfg->charset_for_col_bind, 0);
+  if (!r) r = _conn_key_append(&mem, cfg->charset_for_param_bind, 0);
+  if (r) {
+    mem_release(&mem);
+    return NULL;
+  }
+
+  return (char*)mem.base;
+}
+
+static int _conn_pool_validate(conn_t *conn)
+{
+  // NOTE: the server might have dropped the session while it was idle
+  const char *sql = "select server_version()";
+  ds_res_t ds_res = {0};
+
+  int r = ds_conn_query(&conn->ds_conn, sql, &ds_res);
+  if (r) {
+    int e = ds_res_errno(&ds_res);
+    const char *estr = ds_res_errstr(&ds_res);
+    OW("pooled connection[%p] discarded because of query `%s` failure:[%d]%s", conn->ds_conn.taos, sql, e, estr);
+  }
+
+  ds_res_close(&ds_res);
+
+  return r ? -1 : 0;
+}
+
+static int _conn_pool_take(conn_t *conn, const char *key)
+{
+  conn_pool_t *pool = &conn->env->pool;
+  conn_pooled_t *found = NULL;
+  struct tod_list_head expireds;
+  INIT_TOD_LIST_HEAD(&expireds);
+
+  int64_t now = _conn_clock_seconds();
+
+  pthread_mutex_lock(&pool->mutex);
+  conn_pooled_t *p, *n;
+  tod_list_for_each_entry_safe(p, n, &pool->idles, conn_pooled_t, node) {
+    if (now - p->idle_since > CONN_POOL_IDLE_TTL) {
+      tod_list_del(&p->node);
+      tod_list_add(&p->node, &expireds);
+      pool->nr -= 1;
+      continue;
+    }
+    if (!found && strcmp(p->key, key) == 0) {
+      tod_list_del(&p->node);
+      pool->nr -= 1;
+      found = p;
+    }
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  // NOTE: closed without the lock held, since closing might take a round trip
+  tod_list_for_each_entry_safe(p, n, &expireds, conn_pooled_t, node) {
+    tod_list_del(&p->node);
+    _conn_pooled_free(p);
+  }
+
+  if (found) {
+    conn->ds_conn.taos = found->taos;
+    found->taos        = NULL;
+    if (_conn_pool_validate(conn)) {
+      ds_conn_close(&conn->ds_conn);
+      _conn_pooled_free(found);
+      found = NULL;
+    }
+  }
+
+  pthread_mutex_lock(&pool->mutex);
+  if (found) pool->hits   += 1;
+  else       pool->misses += 1;
+  pthread_mutex_unlock(&pool->mutex);
+
+  if (!found) return 0;
+
+  _conn_release_information_schema_ins_configs(conn);
+
+  conn->svr_info         = found->svr_info;
+  conn->tz               = found->tz;
+  conn->tz_seconds       = found->tz_seconds;
+  conn->s_statusInterval = found->s_statusInterval;
+  conn->s_timezone       = found->s_timezone;
+  conn->s_locale         = found->s_locale;
+  conn->s_charset        = found->s_charset;
+  snprintf(conn->sqlc_charset, sizeof(conn->sqlc_charset), "%s", found->sqlc_charset);
+  snprintf(conn->tsdb_charset, sizeof(conn->tsdb_charset), "%s", found->tsdb_charset);
+  conn->configs_loaded   = found->configs_loaded;
+  conn->tz_loaded        = found->tz_loaded;
+
+  found->s_statusInterval = NULL;
+  found->s_timezone       = NULL;
+  found->s_locale         = NULL;
+  found->s_charset        = NULL;
+  _conn_pooled_free(found);
+
+  return 1;
+}
+
+static int _conn_pool_reset_db(conn_t *conn)
+{
+  const char *db = conn->cfg.db;
+
+  char curr[193];
+  ds_err_t ds_err;
+  ds_err.err = 0;
+  ds_err.str[0] = '\0';
+  if (ds_conn_get_current_db(&conn->ds_conn, curr, sizeof(curr), &ds_err)) return -1;
+
+  if (db && tod_strcasecmp(curr, db) == 0) return 0;
+  if (!db && !curr[0]) return 0;
+
+  // NOTE: a session that has `use`d another db without a configured one could not be reverted
+  if (!db) return -1;
+  if (conn->cfg.url) return -1;
+
+  return CALL_taos_select_db((TAOS*)conn->ds_conn.taos, db) ? -1 : 0;
+}
+
+static int _conn_pool_put(conn_t *conn)
+{
+  conn_pool_t *pool = &conn->env->pool;
+  size_t size = _conn_pool_size(conn);
+
+  if (!conn->pool_key || !conn->ds_conn.taos || size == 0) return -1;
+  if (_conn_pool_reset_db(conn)) return -1;
+
+  conn_pooled_t *pooled = (conn_pooled_t*)calloc(1, sizeof(*pooled));
+  if (!pooled) return -1;
+
+  pthread_mutex_lock(&pool->mutex);
+  size_t nr = 0;
+  conn_pooled_t *p;
+  tod_list_for_each_entry(p, &pool->idles, conn_pooled_t, node) {
+    if (strcmp(p->key, conn->pool_key) == 0) ++nr;
+  }
+  if (nr >= size) {
+    pthread_mutex_unlock(&pool->mutex);
+    free(pooled);
+    return -1;
+  }
+
+  pooled->key              = conn->pool_key;
+  pooled->taos             = conn->ds_conn.taos;
+  pooled->ws               = !!conn->cfg.url;
+  pooled->idle_since       = _conn_clock_seconds();
+  pooled->svr_info         = conn->svr_info;
+  pooled->tz               = conn->tz;
+  pooled->tz_seconds       = conn->tz_seconds;
+  pooled->s_statusInterval = conn->s_statusInterval;
+  pooled->s_timezone       = conn->s_timezone;
+  pooled->s_locale         = conn->s_locale;
+  pooled->s_charset        = conn->s_charset;
+  snprintf(pooled->sqlc_charset, sizeof(pooled->sqlc_charset), "%s", conn->sqlc_charset);
+  snprintf(pooled->tsdb_charset, sizeof(pooled->tsdb_charset), "%s", conn->tsdb_charset);
+  pooled->configs_loaded   = conn->configs_loaded;
+  pooled->tz_loaded        = conn->tz_loaded;
+
+  tod_list_add(&pooled->node, &pool->idles);
+  pool->nr += 1;
+  pthread_mutex_unlock(&pool->mutex);
+
+  conn->pool_key         = NULL;
+  conn->ds_conn.taos     = NULL;
+  conn->svr_info         = NULL;
+  conn->s_statusInterval = NULL;
+  conn->s_timezone       = NULL;
+  conn->s_locale         = NULL;
+  conn->s_charset        = NULL;
+  conn->sqlc_charset[0]  = '\0';
+  conn->tsdb_charset[0]  = '\0';
+  conn->configs_loaded   = 0;
+  conn->tz_loaded        = 0;
+
+  return 0;
+}
+
 static SQLRETURN _do_conn_connect(conn_t *conn)
 {
   SQLRETURN sr;
 
   ds_conn_setup(&conn->ds_conn);
 
+  TOD_SAFE_FREE(conn->pool_key);
+  if (_conn_pool_size(conn)) {
+    conn->pool_key = _conn_pool_key(conn);
+    if (!conn->pool_key) {
+      conn_oom(conn);
+      return SQL_ERROR;
+    }
+    if (_conn_pool_take(conn, conn->pool_key)) {
+      // NOTE: the handle might be pooled by a LAZY_INIT connection
+      if (!conn->cfg.lazy_init && (_conn_load_configs(conn) || _conn_load_timezone(conn))) {
+        conn_disconnect(conn);
+        return SQL_ERROR;
+      }
+      conn->errs.connected_conn = conn;
+      return SQL_SUCCESS;
+    }
+  }
+
   const conn_cfg_t *cfg = &conn->cfg;
   const char *db = cfg->db;
   if (conn->cfg.url) {
@@ -683,6 +1156,46 @@ static void _conn_fill_out_connection_str(
   }
   if (n>0) count += n;
 
+  if (conn->cfg.prefetch) {
+    fixed_buf_sprintf(n, &buffer, "PREFETCH=1;");
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.cursor_cache_size) {
+    fixed_buf_sprintf(n, &buffer, "CURSOR_CACHE_SIZE=%u;", conn->cfg.cursor_cache_size);
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.batch_bytes) {
+    fixed_buf_sprintf(n, &buffer, "BATCH_BYTES=%u;", conn->cfg.batch_bytes);
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.parallel_insert) {
+    fixed_buf_sprintf(n, &buffer, "PARALLEL_INSERT=%u;", conn->cfg.parallel_insert);
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.stmt_cache) {
+    fixed_buf_sprintf(n, &buffer, "STMT_CACHE=%u;", conn->cfg.stmt_cache);
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.conn_pool) {
+    fixed_buf_sprintf(n, &buffer, "CONN_POOL=%u;", conn->cfg.conn_pool);
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.meta_cache_ttl) {
+    fixed_buf_sprintf(n, &buffer, "META_CACHE_TTL=%u;", conn->cfg.meta_cache_ttl);
+    if (n>0) count += n;
+  }
+
+  if (conn->cfg.lazy_init) {
+    fixed_buf_sprintf(n, &buffer, "LAZY_INIT=1;");
+    if (n>0) count += n;
+  }
+
   if (conn->cfg.customproduct) {
     fixed_buf_sprintf(n, &buffer, "CUSTOMPRODUCT=%s;", conn->cfg.customproduct_name);
   }
@@ -772,6 +1285,38 @@ static int _conn_cfg_init_by_dsn(conn_cfg_t *cfg, char *ebuf, size_t elen)
   r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "CONN_MODE", (LPCSTR)"0", (LPSTR)buf, sizeof(buf), "Odbc.ini");
   if (r == 1) cfg->conn_mode = !!atoi(buf);
 
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "PREFETCH", (LPCSTR)"0", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (r == 1) cfg->prefetch = !!atoi(buf);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "CURSOR_CACHE_SIZE", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (buf[0]) cfg->cursor_cache_size = (unsigned int)strtoul(buf, NULL, 10);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "BATCH_BYTES", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (buf[0]) cfg->batch_bytes = (unsigned int)strtoul(buf, NULL, 10);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "PARALLEL_INSERT", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (buf[0]) cfg->parallel_insert = (unsigned int)strtoul(buf, NULL, 10);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "STMT_CACHE", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (buf[0]) cfg->stmt_cache = (unsigned int)strtoul(buf, NULL, 10);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "CONN_POOL", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (buf[0]) cfg->conn_pool = (unsigned int)strtoul(buf, NULL, 10);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "META_CACHE_TTL", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (buf[0]) cfg->meta_cache_ttl = (unsigned int)strtoul(buf, NULL, 10);
+
+  buf[0] = '\0';
+  r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "LAZY_INIT", (LPCSTR)"0", (LPSTR)buf, sizeof(buf), "Odbc.ini");
+  if (r == 1) cfg->lazy_init = !!atoi(buf);
+
   buf[0] = '\0';
   r = SQLGetPrivateProfileString((LPCSTR)cfg->dsn, "CUSTOMPRODUCT", (LPCSTR)"", (LPSTR)buf, sizeof(buf), "Odbc.ini");
   if (r > 0) {
@@ -887,6 +1432,53 @@ SQLRETURN conn_driver_connect(
   return SQL_ERROR;
 }
 
+static TAOS* _conn_get_shard(conn_t *conn, size_t i_shard)
+{
+  const conn_cfg_t *cfg = &conn->cfg;
+
+  if (i_shard >= conn->nr_shards) {
+    size_t nr = i_shard + 1;
+    TAOS **shards = (TAOS**)realloc(conn->shards, sizeof(*shards) * nr);
+    if (!shards) return NULL;
+    memset(shards + conn->nr_shards, 0, sizeof(*shards) * (nr - conn->nr_shards));
+    conn->shards    = shards;
+    conn->nr_shards = nr;
+  }
+
+  TAOS *taos = conn->shards[i_shard];
+  if (!taos) {
+    taos = CALL_taos_connect(cfg->ip, cfg->uid, cfg->pwd, NULL, cfg->port);
+    if (!taos) return NULL;
+    conn->shards[i_shard] = taos;
+  }
+
+  // NOTE: follow `use <db>` issued on the main connection
+  char db[193]; db[0] = '\0';
+  ds_err_t ds_err; ds_err.err = 0; ds_err.str[0] = '\0';
+  if (ds_conn_get_current_db(&conn->ds_conn, db, sizeof(db), &ds_err) == 0 && db[0]) {
+    if (CALL_taos_select_db(taos, db)) return NULL;
+  }
+
+  return taos;
+}
+
+TAOS* conn_get_shard(conn_t *conn, size_t i_shard)
+{
+  pthread_mutex_lock(&conn->shards_mutex);
+  TAOS *taos = _conn_get_shard(conn, i_shard);
+  pthread_mutex_unlock(&conn->shards_mutex);
+  return taos;
+}
+
+static void _conn_close_shards(conn_t *conn)
+{
+  for (size_t i = 0; i < conn->nr_shards; ++i) {
+    if (conn->shards[i]) CALL_taos_close(conn->shards[i]);
+  }
+  TOD_SAFE_FREE(conn->shards);
+  conn->nr_shards = 0;
+}
+
 void conn_disconnect(conn_t *conn)
 {
   stmt_t *p, *n;
@@ -898,7 +1490,10 @@ void conn_disconnect(conn_t *conn)
   }
   conn->nr_stmts = 0;
 
-  ds_conn_close(&conn->ds_conn);
+  tsdb_prepared_cache_clear(&conn->prepared_cache);
+  _conn_close_shards(conn);
+  if (_conn_pool_put(conn)) ds_conn_close(&conn->ds_conn);
+  TOD_SAFE_FREE(conn->pool_key);
   conn_cfg_release(&conn->cfg);
 }
 
@@ -1300,7 +1895,8 @@ SQLRETURN conn_get_info(
     case SQL_SERVER_NAME:
       return _conn_set_string(conn, "", InfoType, InfoValuePtr, BufferLength, StringLengthPtr);
     case SQL_STATIC_CURSOR_ATTRIBUTES1:
-      *(SQLUINTEGER*)InfoValuePtr = SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE;
+      // NOTE: static cursors are backed by the native result cache, websocket backend is forward-only
+      *(SQLUINTEGER*)InfoValuePtr = conn_is_ws_backended(conn) ? 0 : (SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE);
       return SQL_SUCCESS;
     case SQL_STATIC_CURSOR_ATTRIBUTES2:
       *(SQLUINTEGER*)InfoValuePtr = 0;
@@ -1356,8 +1952,9 @@ SQLRETURN conn_get_info(
     case SQL_SCHEMA_TERM: // SQL_OWNER_TERM
       return _conn_set_string(conn, "schema", InfoType, InfoValuePtr, BufferLength, StringLengthPtr);
     case SQL_SCROLL_OPTIONS:
-      *(SQLUINTEGER*)InfoValuePtr = 0;
-      return SQL_SUCCESS;;
+      *(SQLUINTEGER*)InfoValuePtr = SQL_SO_FORWARD_ONLY;
+      if (!conn_is_ws_backended(conn)) *(SQLUINTEGER*)InfoValuePtr |= SQL_SO_STATIC;
+      return SQL_SUCCESS;
     case SQL_TABLE_TERM:
       break;
     case SQL_TXN_CAPABLE:
@@ -1613,7 +2210,10 @@ SQLRETURN conn_get_info(
     // NOTE: https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlgetinfo-function?view=sql-server-ver16#information-types-deprecated-in-odbc-3x
     // NOTE: https://learn.microsoft.com/en-us/sql/odbc/reference/appendixes/sqlgetinfo-support?view=sql-server-ver16
     case SQL_FETCH_DIRECTION:
-      *(SQLINTEGER*)InfoValuePtr = SQL_FD_FETCH_NEXT; // FIXME:
+      *(SQLINTEGER*)InfoValuePtr = SQL_FD_FETCH_NEXT;
+      if (!conn_is_ws_backended(conn)) {
+        *(SQLINTEGER*)InfoValuePtr |= SQL_FD_FETCH_FIRST | SQL_FD_FETCH_LAST | SQL_FD_FETCH_PRIOR | SQL_FD_FETCH_ABSOLUTE | SQL_FD_FETCH_RELATIVE;
+      }
       return SQL_SUCCESS;
     case SQL_LOCK_TYPES:
       *(SQLINTEGER*)InfoValuePtr = SQL_LCK_NO_CHANGE; // FIXME:
@@ -1852,6 +2452,44 @@ static SQLRETURN _conn_get_attr_current_qualifier(
   return SQL_SUCCESS;
 }
 
+static SQLRETURN _conn_get_attr_stmt_cache_counter(conn_t *conn, SQLINTEGER Attribute, SQLPOINTER Value)
+{
+  tsdb_prepared_cache_t *cache = &conn->prepared_cache;
+
+  pthread_mutex_lock(&cache->mutex);
+  size_t n = (Attribute == SQL_ATTR_TAOS_STMT_CACHE_HITS) ? cache->hits : cache->misses;
+  pthread_mutex_unlock(&cache->mutex);
+
+  *(SQLULEN*)Value = (SQLULEN)n;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _conn_get_attr_conn_pool_counter(conn_t *conn, SQLINTEGER Attribute, SQLPOINTER Value)
+{
+  conn_pool_t *pool = &conn->env->pool;
+
+  pthread_mutex_lock(&pool->mutex);
+  size_t n = (Attribute == SQL_ATTR_TAOS_CONN_POOL_HITS) ? pool->hits : pool->misses;
+  pthread_mutex_unlock(&pool->mutex);
+
+  *(SQLULEN*)Value = (SQLULEN)n;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _conn_get_attr_meta_cache_counter(conn_t *conn, SQLINTEGER Attribute, SQLPOINTER Value)
+{
+  (void)conn;
+
+  pthread_once(&_meta_once, _conn_meta_init_once);
+
+  pthread_mutex_lock(&_meta_mutex);
+  size_t n = (Attribute == SQL_ATTR_TAOS_META_CACHE_HITS) ? _meta_hits : _meta_misses;
+  pthread_mutex_unlock(&_meta_mutex);
+
+  *(SQLULEN*)Value = (SQLULEN)n;
+  return SQL_SUCCESS;
+}
+
 static SQLRETURN _conn_check_alive(conn_t *conn, SQLPOINTER Value)
 {
   int r = 0;
@@ -1954,6 +2592,15 @@ SQLRETURN conn_get_attr(
     case SQL_ATTR_TXN_ISOLATION:
       *(SQLUINTEGER*)Value = conn->txn_isolation;
       return SQL_SUCCESS;
+    case SQL_ATTR_TAOS_STMT_CACHE_HITS:
+    case SQL_ATTR_TAOS_STMT_CACHE_MISSES:
+      return _conn_get_attr_stmt_cache_counter(conn, Attribute, Value);
+    case SQL_ATTR_TAOS_CONN_POOL_HITS:
+    case SQL_ATTR_TAOS_CONN_POOL_MISSES:
+      return _conn_get_attr_conn_pool_counter(conn, Attribute, Value);
+    case SQL_ATTR_TAOS_META_CACHE_HITS:
+    case SQL_ATTR_TAOS_META_CACHE_MISSES:
+      return _conn_get_attr_meta_cache_counter(conn, Attribute, Value);
     default:
       break;
   }
@@ -2048,6 +2695,12 @@ const char* conn_get_sqlc_charset(conn_t *conn)
 
 const char* conn_get_tsdb_charset(conn_t *conn)
 {
+  if (!conn->configs_loaded && conn->ds_conn.taos) {
+    if (_conn_load_configs(conn)) {
+      OW("connection [%p]:lazily loading `information_schema.ins_configs` failed, falls back to `UTF-8`", conn);
+      return "UTF-8";
+    }
+  }
   return conn->tsdb_charset;
 }
 
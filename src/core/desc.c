@@ -258,6 +258,14 @@ SQLRETURN descriptor_bind_col(descriptor_t *ARD,
       ARD_record->DESC_CONCISE_TYPE      = TargetType;
       ARD_record->DESC_OCTET_LENGTH      = ARD_record->DESC_LENGTH;
       break;
+    case SQL_C_TYPE_TIMESTAMP:
+      ARD_record->DESC_LENGTH            = sizeof(SQL_TIMESTAMP_STRUCT);
+      ARD_record->DESC_PRECISION         = 0;
+      ARD_record->DESC_SCALE             = 0;
+      ARD_record->DESC_TYPE              = SQL_DATETIME;
+      ARD_record->DESC_CONCISE_TYPE      = TargetType;
+      ARD_record->DESC_OCTET_LENGTH      = ARD_record->DESC_LENGTH;
+      break;
     case SQL_C_CHAR:
       ARD_record->DESC_LENGTH            = 0; // FIXME:
       ARD_record->DESC_PRECISION         = 0;
@@ -83,10 +83,185 @@ int env_get_debug_bison(env_t *env)
   return !!env->debug_bison;
 }
 
+static int64_t _timers_now_ms(void)
+{
+  struct timespec ts = {0};
+  timespec_get(&ts, TIME_UTC);
+  return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void _timers_swap(query_timers_t *timers, size_t a, size_t b)
+{
+  query_timer_t *t = timers->heap[a];
+  timers->heap[a] = timers->heap[b];
+  timers->heap[b] = t;
+  timers->heap[a]->idx = a;
+  timers->heap[b]->idx = b;
+}
+
+static void _timers_sift_up(query_timers_t *timers, size_t i)
+{
+  while (i > 0) {
+    size_t parent = (i - 1) / 2;
+    if (timers->heap[parent]->deadline <= timers->heap[i]->deadline) break;
+    _timers_swap(timers, parent, i);
+    i = parent;
+  }
+}
+
+static void _timers_sift_down(query_timers_t *timers, size_t i)
+{
+  while (1) {
+    size_t l = 2 * i + 1;
+    size_t r = l + 1;
+    size_t m = i;
+    if (l < timers->nr && timers->heap[l]->deadline < timers->heap[m]->deadline) m = l;
+    if (r < timers->nr && timers->heap[r]->deadline < timers->heap[m]->deadline) m = r;
+    if (m == i) break;
+    _timers_swap(timers, m, i);
+    i = m;
+  }
+}
+
+static void _timers_remove(query_timers_t *timers, size_t i)
+{
+  query_timer_t *timer = timers->heap[i];
+  timers->nr -= 1;
+  if (i < timers->nr) {
+    timers->heap[i] = timers->heap[timers->nr];
+    timers->heap[i]->idx = i;
+    _timers_sift_down(timers, i);
+    _timers_sift_up(timers, i);
+  }
+  timer->armed = 0;
+}
+
+static void* _timers_routine(void *arg)
+{
+  query_timers_t *timers = (query_timers_t*)arg;
+
+  pthread_mutex_lock(&timers->mutex);
+  while (!timers->stop) {
+    if (timers->nr == 0) {
+      pthread_cond_wait(&timers->cond, &timers->mutex);
+      continue;
+    }
+    query_timer_t *timer = timers->heap[0];
+    if (timer->deadline > _timers_now_ms()) {
+      struct timespec abstime = {0};
+      abstime.tv_sec  = (time_t)(timer->deadline / 1000);
+      abstime.tv_nsec = (long)(timer->deadline % 1000) * 1000000;
+      pthread_cond_timedwait(&timers->cond, &timers->mutex, &abstime);
+      continue;
+    }
+    _timers_remove(timers, 0);
+    timer->fired  = 1;
+    timer->firing = 1;
+    // NOTE: fire() might block, eg. taos_kill_query, thus arming/disarming other timers shall not wait for it
+    pthread_mutex_unlock(&timers->mutex);
+    timer->fire(timer->arg);
+    pthread_mutex_lock(&timers->mutex);
+    timer->firing = 0;
+    pthread_cond_broadcast(&timers->fired);
+  }
+  pthread_mutex_unlock(&timers->mutex);
+
+  return NULL;
+}
+
+static int _timers_init(query_timers_t *timers)
+{
+  if (pthread_mutex_init(&timers->mutex, NULL)) return -1;
+  if (pthread_cond_init(&timers->cond, NULL)) {
+    pthread_mutex_destroy(&timers->mutex);
+    return -1;
+  }
+  if (pthread_cond_init(&timers->fired, NULL)) {
+    pthread_cond_destroy(&timers->cond);
+    pthread_mutex_destroy(&timers->mutex);
+    return -1;
+  }
+  return 0;
+}
+
+static void _timers_release(query_timers_t *timers)
+{
+  if (timers->started) {
+    pthread_mutex_lock(&timers->mutex);
+    timers->stop = 1;
+    pthread_cond_signal(&timers->cond);
+    pthread_mutex_unlock(&timers->mutex);
+    pthread_join(timers->worker, NULL);
+    timers->started = 0;
+  }
+  OA_ILE(timers->nr == 0);
+  TOD_SAFE_FREE(timers->heap);
+  timers->cap = 0;
+  pthread_cond_destroy(&timers->fired);
+  pthread_cond_destroy(&timers->cond);
+  pthread_mutex_destroy(&timers->mutex);
+}
+
+int env_timer_arm(env_t *env, query_timer_t *timer, int64_t seconds)
+{
+  query_timers_t *timers = &env->timers;
+  int r = 0;
+
+  OA_ILE(!timer->armed);
+  timer->fired    = 0;
+  timer->deadline = _timers_now_ms() + seconds * 1000;
+
+  pthread_mutex_lock(&timers->mutex);
+  do {
+    if (!timers->started) {
+      if (pthread_create(&timers->worker, NULL, _timers_routine, timers)) {
+        r = -1;
+        break;
+      }
+      timers->started = 1;
+    }
+    if (timers->nr == timers->cap) {
+      size_t cap = timers->cap ? timers->cap * 2 : 16;
+      query_timer_t **heap = (query_timer_t**)realloc(timers->heap, sizeof(*heap) * cap);
+      if (!heap) {
+        r = -1;
+        break;
+      }
+      timers->heap = heap;
+      timers->cap  = cap;
+    }
+    timer->idx = timers->nr;
+    timers->heap[timers->nr++] = timer;
+    timer->armed = 1;
+    _timers_sift_up(timers, timer->idx);
+    // NOTE: wake up the worker only if the earliest deadline changes
+    if (timer->idx == 0) pthread_cond_signal(&timers->cond);
+  } while (0);
+  pthread_mutex_unlock(&timers->mutex);
+
+  return r;
+}
+
+int env_timer_disarm(env_t *env, query_timer_t *timer)
+{
+  query_timers_t *timers = &env->timers;
+
+  pthread_mutex_lock(&timers->mutex);
+  if (timer->armed) _timers_remove(timers, timer->idx);
+  // NOTE: the owner of the timer might be freed once we return, thus wait for the fire() in progress
+  while (timer->firing) pthread_cond_wait(&timers->fired, &timers->mutex);
+  int fired = timer->fired;
+  pthread_mutex_unlock(&timers->mutex);
+
+  return fired;
+}
+
 static void _env_release(env_t *env)
 {
   int conns = atomic_load(&env->conns);
   OA_ILE(conns == 0);
+  conn_pool_release(&env->pool);
+  _timers_release(&env->timers);
   errs_release(&env->errs);
   mem_release(&env->mem);
 }
@@ -96,6 +271,17 @@ env_t* env_create(void)
   env_t *env = (env_t*)calloc(1, sizeof(*env));
   if (!env) return NULL;
 
+  if (conn_pool_init(&env->pool)) {
+    free(env);
+    return NULL;
+  }
+
+  if (_timers_init(&env->timers)) {
+    conn_pool_release(&env->pool);
+    free(env);
+    return NULL;
+  }
+
   int r = _env_init(env);
   if (r) {
     _env_release(env);
@@ -199,8 +385,9 @@ SQLRETURN env_set_attr(
   switch (Attribute) {
 #if (ODBCVER >= 0x0380)      /* { */
     case SQL_ATTR_CONNECTION_POOLING:
-      // NOTE: SQL_ATTR_CONNECTION_POOLING is implemented inside the Driver Manager
-      break;
+      // NOTE: the Driver Manager normally keeps this for itself, if it ever reaches here, pool in env, see CONN_POOL
+      env->connection_pooling = (SQLUINTEGER)(uintptr_t)ValuePtr;
+      return SQL_SUCCESS;
 #endif                       /* } */
     case SQL_ATTR_CP_MATCH:
       if (*(SQLUINTEGER*)ValuePtr == SQL_CP_STRICT_MATCH) return SQL_SUCCESS;
@@ -237,8 +424,8 @@ SQLRETURN env_get_attr(
   switch (Attribute) {
 #if (ODBCVER >= 0x0380)      /* { */
     case SQL_ATTR_CONNECTION_POOLING:
-      // NOTE: SQL_ATTR_CONNECTION_POOLING is implemented inside the Driver Manager
-      break;
+      *(SQLUINTEGER*)Value = env->connection_pooling;
+      return SQL_SUCCESS;
 #endif                       /* } */
     case SQL_ATTR_CP_MATCH:
       *(SQLUINTEGER*)Value = SQL_CP_STRICT_MATCH;
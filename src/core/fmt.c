@@ -0,0 +1,239 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022-2023 freemine <freemine@yeah.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal.h"
+
+#include "fmt.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char _digits2[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+static const double _pow10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+  1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+};
+
+static size_t _fmt_nr_digits(uint64_t v)
+{
+  size_t n = 1;
+  for (;;) {
+    if (v < 10)     return n;
+    if (v < 100)    return n + 1;
+    if (v < 1000)   return n + 2;
+    if (v < 10000)  return n + 3;
+    v /= 10000;
+    n += 4;
+  }
+}
+
+static void _fmt_digits(char *end, uint64_t v)
+{
+  // NOTE: writes backward, two digits at a time, `end` points right after the last digit
+  while (v >= 100) {
+    unsigned int i = (unsigned int)(v % 100) * 2;
+    v /= 100;
+    *--end = _digits2[i + 1];
+    *--end = _digits2[i];
+  }
+  if (v >= 10) {
+    unsigned int i = (unsigned int)v * 2;
+    *--end = _digits2[i + 1];
+    *--end = _digits2[i];
+  } else {
+    *--end = (char)('0' + v);
+  }
+}
+
+size_t fmt_uint64(char *s, uint64_t v)
+{
+  size_t n = _fmt_nr_digits(v);
+  _fmt_digits(s + n, v);
+  s[n] = '\0';
+  return n;
+}
+
+size_t fmt_int64(char *s, int64_t v)
+{
+  if (v >= 0) return fmt_uint64(s, (uint64_t)v);
+  *s = '-';
+  return 1 + fmt_uint64(s + 1, (uint64_t)0 - (uint64_t)v);
+}
+
+static size_t _fmt_fixed(char *s, int neg, uint64_t m, size_t k)
+{
+  // NOTE: m * 10^-k in fixed notation, trailing zeros never happen since k is the least one that round-trips
+  char *p = s;
+  if (neg) *p++ = '-';
+
+  size_t n = _fmt_nr_digits(m);
+  if (n <= k) {
+    *p++ = '0';
+    *p++ = '.';
+    for (size_t i = n; i < k; ++i) *p++ = '0';
+    _fmt_digits(p + n, m);
+    p += n;
+  } else if (k == 0) {
+    _fmt_digits(p + n, m);
+    p += n;
+  } else {
+    uint64_t ip = m / (uint64_t)_pow10[k];
+    uint64_t fp = m - ip * (uint64_t)_pow10[k];
+    size_t   ni = n - k;
+    _fmt_digits(p + ni, ip);
+    p += ni;
+    *p++ = '.';
+    _fmt_digits(p + k, fp);
+    for (size_t i = _fmt_nr_digits(fp); i < k; ++i) p[k - 1 - i] = '0';
+    p += k;
+  }
+
+  *p = '\0';
+  return (size_t)(p - s);
+}
+
+static size_t _fmt_special(char *s, double v)
+{
+  if (isnan(v)) return (size_t)snprintf(s, FMT_MAX + 1, "%s", signbit(v) ? "-nan" : "nan");
+  if (isinf(v)) return (size_t)snprintf(s, FMT_MAX + 1, "%s", v < 0 ? "-inf" : "inf");
+  return (size_t)snprintf(s, FMT_MAX + 1, "%s", signbit(v) ? "-0" : "0");
+}
+
+size_t fmt_double(char *s, double v)
+{
+  if (v == 0 || !isfinite(v)) return _fmt_special(s, v);
+
+  int    neg = v < 0;
+  double av  = neg ? -v : v;
+
+  // NOTE: fast path, the least k such that round(v * 10^k) / 10^k round-trips to v, as long as it's within 2^53
+  for (size_t k = 0; k < sizeof(_pow10) / sizeof(_pow10[0]); ++k) {
+    double x = av * _pow10[k];
+    if (x >= 9007199254740992.0) break;
+    uint64_t m = (uint64_t)x;
+    if (x - (double)m >= 0.5) ++m;
+    if ((double)m / _pow10[k] == av) return _fmt_fixed(s, neg, m, k);
+  }
+
+  // NOTE: very large or tiny ones, the shortest %g that round-trips
+  //       subnormals carry fewer significant digits, thus are searched from the shortest precision upwards
+  int n = 0;
+  for (int prec = (av < DBL_MIN) ? 1 : 15; prec <= 17; ++prec) {
+    n = snprintf(s, FMT_MAX + 1, "%.*g", prec, v);
+    if (strtod(s, NULL) == v) break;
+  }
+  return (size_t)n;
+}
+
+size_t fmt_float(char *s, float v)
+{
+  if (v == 0 || !isfinite(v)) return _fmt_special(s, v);
+
+  int    neg = v < 0;
+  float  av  = neg ? -v : v;
+
+  for (size_t k = 0; k < sizeof(_pow10) / sizeof(_pow10[0]); ++k) {
+    double x = (double)av * _pow10[k];
+    if (x >= 16777216.0) break;
+    uint64_t m = (uint64_t)x;
+    if (x - (double)m >= 0.5) ++m;
+    if ((float)((double)m / _pow10[k]) == av) return _fmt_fixed(s, neg, m, k);
+  }
+
+  int n = 0;
+  for (int prec = (av < FLT_MIN) ? 1 : 6; prec <= 9; ++prec) {
+    n = snprintf(s, FMT_MAX + 1, "%.*g", prec, (double)v);
+    if (strtof(s, NULL) == v) break;
+  }
+  return (size_t)n;
+}
+
+static char* _fmt_2(char *p, int v)
+{
+  p[0] = _digits2[v * 2];
+  p[1] = _digits2[v * 2 + 1];
+  return p + 2;
+}
+
+size_t fmt_timestamp(char *s, const struct tm *tm, int32_t fraction, int w)
+{
+  int year = tm->tm_year + 1900;
+  if (year < 0 || year > 9999 || fraction < 0 || w < 0 || w > 9) {
+    return (size_t)snprintf(s, FMT_MAX + 1,
+        "%04d-%02d-%02d %02d:%02d:%02d.%0*d",
+        year, tm->tm_mon + 1, tm->tm_mday,
+        tm->tm_hour, tm->tm_min, tm->tm_sec,
+        w, fraction);
+  }
+
+  char *p = s;
+  p = _fmt_2(p, year / 100);
+  p = _fmt_2(p, year % 100);
+  *p++ = '-';
+  p = _fmt_2(p, tm->tm_mon + 1);
+  *p++ = '-';
+  p = _fmt_2(p, tm->tm_mday);
+  *p++ = ' ';
+  p = _fmt_2(p, tm->tm_hour);
+  *p++ = ':';
+  p = _fmt_2(p, tm->tm_min);
+  *p++ = ':';
+  p = _fmt_2(p, tm->tm_sec);
+  *p++ = '.';
+  for (int i = w - 1; i >= 0; --i) {
+    p[i] = (char)('0' + fraction % 10);
+    fraction /= 10;
+  }
+  p += w;
+  *p = '\0';
+  return (size_t)(p - s);
+}
+
+size_t fmt_widen_utf16le(char *s, size_t n)
+{
+  // NOTE: backward, thus no character is overwritten before being widened
+  unsigned char *p = (unsigned char*)s;
+  p[n * 2]     = 0;
+  p[n * 2 + 1] = 0;
+  for (size_t i = n; i > 0; --i) {
+    p[(i - 1) * 2 + 1] = 0;
+    p[(i - 1) * 2]     = p[i - 1];
+  }
+  return n * 2;
+}
+
@@ -277,6 +277,76 @@ struct sql_data_s {
   uint8_t               unsigned_:1;
 };
 
+struct conn_pooled_s {
+  struct tod_list_head       node;
+  char                      *key;          // normalized connection attributes, see _conn_pool_key
+
+  void                      *taos;
+  unsigned int               ws:1;
+  int64_t                    idle_since;   // monotonic seconds, see CONN_POOL_IDLE_TTL
+
+  // post-connected state, handed over to/from conn_t as is
+  const char                *svr_info;
+  int64_t                    tz;
+  int64_t                    tz_seconds;
+  char                      *s_statusInterval;
+  char                      *s_timezone;
+  char                      *s_locale;
+  char                      *s_charset;
+  charset_name_t             sqlc_charset;
+  charset_name_t             tsdb_charset;
+  unsigned int               configs_loaded:1;
+  unsigned int               tz_loaded:1;
+};
+
+struct conn_meta_s {
+  struct tod_list_head       node;
+  char                      *key;          // endpoint, see _conn_meta_key
+  int64_t                    expire;       // in monotonic seconds
+
+  int64_t                    tz;
+  int64_t                    tz_seconds;
+  char                      *s_statusInterval;
+  char                      *s_timezone;
+  char                      *s_locale;
+  char                      *s_charset;
+};
+
+struct conn_pool_s {
+  pthread_mutex_t            mutex;
+  struct tod_list_head       idles;        // most recently returned first
+  size_t                     nr;
+
+  size_t                     hits;
+  size_t                     misses;
+};
+
+struct query_timer_s {
+  int64_t                    deadline;     // in ms since the Epoch, as pthread_cond_timedwait requires
+  size_t                     idx;          // position in query_timers_t::heap while armed
+  void                     (*fire)(void *arg);
+  void                      *arg;
+
+  unsigned int               armed:1;
+  unsigned int               fired:1;
+  unsigned int               firing:1;     // fire() running on the worker, without query_timers_t::mutex held
+};
+
+struct query_timers_s {
+  pthread_mutex_t            mutex;
+  pthread_cond_t             cond;
+  pthread_cond_t             fired;        // signaled once fire() returns, see env_timer_disarm
+  pthread_t                  worker;
+
+  // NOTE: binary min-heap on deadline
+  query_timer_t            **heap;
+  size_t                     nr;
+  size_t                     cap;
+
+  unsigned int               started:1;
+  unsigned int               stop:1;
+};
+
 struct env_s {
   atomic_int          refc;
 
@@ -286,6 +356,13 @@ struct env_s {
 
   mem_t               mem;
 
+  // NOTE: see CONN_POOL
+  conn_pool_t         pool;
+  SQLUINTEGER         connection_pooling;
+
+  // NOTE: see SQL_ATTR_QUERY_TIMEOUT, worker started on first arm
+  query_timers_t      timers;
+
   unsigned int        debug_flex:1;
   unsigned int        debug_bison:1;
 };
@@ -329,6 +406,7 @@ struct tsdb_param_column_s {
   mem_t           mem;
   mem_t           mem_length;
   mem_t           mem_is_null;
+  mem_t           mem_done;        // rows already converted by the column-at-a-time kernel
 
   TAOS_FIELD_E    tsdb_field;
 };
@@ -473,6 +551,30 @@ struct conn_cfg_s {
 
   // NOTE: default is 0, BI mode : 1
   unsigned int           conn_mode:1;
+
+  // NOTE: native backend only, request the next block asynchronously while the current one is being converted
+  unsigned int           prefetch:1;
+
+  // NOTE: in MB, static cursor caches fetched blocks in memory up to this size, and spills to a temp file beyond
+  unsigned int           cursor_cache_size;
+
+  // NOTE: in bytes, insert batches are sized to fit and then tuned by observed throughput, 0 for fixed INT16_MAX rows
+  unsigned int           batch_bytes;
+
+  // NOTE: native backend only, number of extra connections paramsets are sharded over by subtbl, 0 or 1 to insert serially
+  unsigned int           parallel_insert;
+
+  // NOTE: native backend only, number of prepared insert statements kept per connection for reuse, 0 to disable
+  unsigned int           stmt_cache;
+
+  // NOTE: number of idle connections with the same attributes kept in env for reuse by SQLDriverConnect, 0 to disable
+  unsigned int           conn_pool;
+
+  // NOTE: in seconds, ins_configs and timezone are cached process-wide per endpoint for this long, 0 to disable
+  unsigned int           meta_cache_ttl;
+
+  // NOTE: ins_configs/timezone are not queried when connecting, but on first use, see conn_get_tsdb_charset
+  unsigned int           lazy_init:1;
 };
 
 struct sqls_parser_nterm_s {
@@ -636,6 +738,32 @@ struct ds_stmt_s {
   int         (*prepare)     (ds_stmt_t *ds_stmt, const char *sql);
 };
 
+struct tsdb_prepared_s {
+  struct tod_list_head       node;
+
+  // NOTE: key, current db at the time of preparing and the converted sql
+  char                      *db;
+  char                      *sql;
+  size_t                     sql_len;
+
+  TAOS_STMT                 *stmt;
+  TAOS_FIELD_E              *tag_fields;
+  int                        nr_tag_fields;
+  TAOS_FIELD_E              *col_fields;
+  int                        nr_col_fields;
+
+  unsigned int               subtbl_required:1;
+};
+
+struct tsdb_prepared_cache_s {
+  pthread_mutex_t            mutex;
+  struct tod_list_head       prepareds;    // most recently parked first
+  size_t                     nr;
+
+  size_t                     hits;
+  size_t                     misses;
+};
+
 struct conn_s {
   atomic_int          refc;
   atomic_int          descs;
@@ -670,10 +798,26 @@ struct conn_s {
   charset_name_t      sqlc_charset;
   charset_name_t      tsdb_charset;
 
+  // NOTE: see LAZY_INIT, s_* and tsdb_charset are valid only once configs_loaded, tz/tz_seconds once tz_loaded
+  unsigned int        configs_loaded:1;
+  unsigned int        tz_loaded:1;
+
   errs_t              errs;
 
   ds_conn_t           ds_conn;
 
+  // NOTE: see PARALLEL_INSERT, connected on first use
+  //       statements of the same connection may execute from different threads, thus guarded by shards_mutex
+  pthread_mutex_t     shards_mutex;
+  TAOS              **shards;
+  size_t              nr_shards;
+
+  // NOTE: see STMT_CACHE
+  tsdb_prepared_cache_t    prepared_cache;
+
+  // NOTE: see CONN_POOL, non-NULL once connected with pooling enabled
+  char               *pool_key;
+
 #ifdef _WIN32           /* { */
   HWND                win_handle;
 #endif                  /* } */
@@ -710,6 +854,11 @@ struct stmt_base_s {
   SQLRETURN (*row_count)(stmt_base_t *base, SQLLEN *row_count_ptr);
   SQLRETURN (*get_num_cols)(stmt_base_t *base, SQLSMALLINT *ColumnCountPtr);
   SQLRETURN (*get_data)(stmt_base_t *base, SQLUSMALLINT Col_or_Param_Num, tsdb_data_t *tsdb);
+  // optional, NULL if rows can only be fetched one at a time
+  SQLRETURN (*fetch_rows_slice)(stmt_base_t *base, size_t nr_max, tsdb_rows_slice_t *slice);
+  // NOTE: optional, static cursor only, i_row is 0-based
+  SQLRETURN (*seek_row)(stmt_base_t *base, size_t i_row);
+  SQLRETURN (*get_num_rows)(stmt_base_t *base, size_t *nr_rows);
 };
 
 struct tsdb_fields_s {
@@ -717,11 +866,84 @@ struct tsdb_fields_s {
   size_t                     nr;
 };
 
+struct tsdb_rows_block_col_s {
+  const int          *offsets;       // for variable-length columns
+  bool               *nulls;
+  size_t              cap;           // capacity of nulls
+  uint8_t             offsets_ready:1;
+  uint8_t             nulls_ready:1;
+};
+
 struct tsdb_rows_block_s {
   TAOS_ROW            rows;
   const void         *ws_ptr;        // NOTE: libtaosws, ugly for the moment!!!
   size_t              nr;
   size_t              pos;           // 1-based
+
+  // decoded lazily, once per column per block
+  tsdb_rows_block_col_t    *cols;
+  size_t                    cols_cap;
+};
+
+struct tsdb_rows_slice_s {
+  tsdb_res_t         *res;
+  size_t              i_row;         // 0-based, within res->rows_block
+  size_t              nr;
+};
+
+struct tsdb_prefetch_s {
+  pthread_mutex_t            mutex;
+  pthread_cond_t             cond;
+  int                        nr_rows;       // code passed to the async callback
+
+  // NOTE: driver-owned copy of the block being converted, so that the next block can land in taosc's buffers meanwhile
+  void                     **cols;
+  size_t                     cols_cap;
+  char                      *buf;
+  size_t                     cap;
+
+  unsigned int               inited:1;
+  unsigned int               pending:1;
+  unsigned int               done:1;
+};
+
+struct tsdb_cached_block_s {
+  size_t                     i_row;         // 0-based, first row of the block within the result set
+  size_t                     nr;
+  size_t                     bytes;
+  char                      *buf;           // NULL if spilled
+  int64_t                    spilled_at;    // offset within the spill file
+};
+
+struct tsdb_res_cache_s {
+  tsdb_cached_block_t       *blocks;
+  size_t                     cap;
+  size_t                     nr;
+  size_t                     nr_rows;
+  size_t                     current;       // block installed in rows_block
+
+  size_t                     mem_bytes;
+  size_t                     mem_limit;
+
+  FILE                      *spill;
+  int64_t                    spill_bytes;
+  char                      *load;          // spilled block read back, or being written
+  size_t                     load_cap;
+  size_t                     loaded;        // 1-based index of the block in load, 0 if none
+
+  void                     **cols;
+  size_t                     cols_cap;
+
+  unsigned int               enabled:1;
+  unsigned int               complete:1;    // server has nothing more to send
+};
+
+struct tsdb_tz_window_s {
+  // NOTE: [lo, hi), in seconds since epoch, within which local time is utc + gmtoff
+  int64_t                    lo;
+  int64_t                    hi;
+  int64_t                    gmtoff;
+  int                        isdst;
 };
 
 struct tsdb_res_s {
@@ -731,6 +953,8 @@ struct tsdb_res_s {
   int                        time_precision;
   tsdb_fields_t              fields;
   tsdb_rows_block_t          rows_block;
+  tsdb_prefetch_t            prefetch;
+  tsdb_res_cache_t           cache;         // static cursor only
 
   unsigned int               res_is_from_taos_query:1;
   unsigned int               eof:1;
@@ -748,7 +972,29 @@ struct tsdb_params_s {
 
   int32_t                             qms; // NOTE: qms_from_sql_parsed_by_taos_odbc;
 
+  // NOTE: first-row tag values last set, together with `subtbl`, valid once executed successfully
+  //       taosc keeps the table bound then, thus set_tbname/set_tags of the same values are skipped
+  mem_t                               tags_memo;
+
   unsigned int                        subtbl_required:1;
+  unsigned int                        memo_valid:1;
+};
+
+struct tsdb_pipeline_s {
+  pthread_t                  worker;
+  TAOS_STMT                 *stmt;
+  int                        r;             // code returned by taos_stmt_execute on the worker
+
+  unsigned int               running:1;
+};
+
+struct tsdb_shard_s {
+  TAOS_STMT                 *stmt;          // prepared on conn->shards[i]
+  tsdb_pipeline_t            pipeline;
+
+  // NOTE: rows in flight, as offsets into the subtbl plan of the paramset
+  size_t                     i_batch_offset;
+  size_t                     nr_batch_size;
 };
 
 struct tsdb_stmt_s {
@@ -766,9 +1012,21 @@ struct tsdb_stmt_s {
 
   tsdb_res_t                 res;
 
+  // NOTE: native backend only, batch N executes on a worker while batch N+1 is being converted
+  tsdb_pipeline_t            pipeline;
+
+  // NOTE: see PARALLEL_INSERT
+  tsdb_shard_t              *shards;
+  size_t                     nr_shards;
+
+  // NOTE: see STMT_CACHE, entry keyed by the sql being prepared, parked back into conn->prepared_cache when unprepared
+  tsdb_prepared_t           *checkout;
+
   unsigned int               prepared:1;
   unsigned int               is_ext:1;
   unsigned int               is_insert_stmt:1;
+  // NOTE: nothing bound since prepared or last executed successfully, thus could be parked into conn->prepared_cache
+  unsigned int               idle:1;
 };
 
 struct topic_s {
@@ -917,13 +1175,43 @@ struct typesinfo_s {
   size_t                     pos; // 1-based
 };
 
+struct param_subtbl_row_s {
+  const char                *name;
+  size_t                     name_len;
+  size_t                     i_row;
+};
+
+struct param_subtbl_group_s {
+  size_t                     name_offset;
+  size_t                     name_len;
+  size_t                     nr_rows;
+  size_t                     i_next;
+};
+
 struct param_state_s {
   int                        nr_batch_size;
   size_t                     i_batch_offset;
 
+  // NOTE: rows of the batch whose execute is in flight, see SQL_ATTR_TAOS_PIPELINED_INSERT
+  int                        nr_pipelined_size;
+  size_t                     i_pipelined_offset;
+
+  // NOTE: paramset rows grouped by subtbl, batches are cut from this when non-NULL
+  const param_subtbl_row_t  *subtbl_rows;
+  size_t                     nr_subtbl_rows;
+  size_t                     nr_subtbl_rejected;
+  mem_t                      subtbl_plan;
+  mem_t                      subtbl_names;
+  mem_t                      subtbl_groups;
+
+  // NOTE: per row of the batch, non-zero if rejected and to be compacted out, see SQL_ATTR_TAOS_CONTINUE_ON_ERROR
+  mem_t                      row_skips;
+  int                        nr_batch_skipped;
+
   SQLSMALLINT                nr_tsdb_fields;
 
   int                        i_row;
+  int                        i_bind;
   int                        i_param;
   desc_record_t             *APD_record;
   desc_record_t             *IPD_record;
@@ -946,6 +1234,12 @@ struct param_state_s {
   uint8_t                    is_subtbl:1;
   uint8_t                    row_with_info:1;
   uint8_t                    row_err:1;
+  uint8_t                    zero_copy:1;      // current column of the batch bound in place to the application buffer
+  uint8_t                    col_done:1;       // current column of the batch converted at once, see mem_done
+  uint8_t                    pipelined:1;      // execute of the previous batch might still be in flight
+  uint8_t                    sharded:1;        // batches go to tsdb_stmt.shards by subtbl, see PARALLEL_INSERT
+  uint8_t                    continue_on_error:1;
+  uint8_t                    rows_skipped:1;   // any row rejected so far in this execute
 };
 
 struct col_bind_map_s {
@@ -986,6 +1280,29 @@ struct params_bind_meta_s {
   size_t                     nr;
 };
 
+typedef SQLRETURN (*col_f)(stmt_t *stmt, stmt_get_data_args_t *args);
+
+struct col_bind_meta_s {
+  int8_t                      tsdb_type;
+  SQLSMALLINT                 TargetType;
+  col_f                       copy;      // copy tsdb_data into the bound buffer, NULL if generic path is needed
+  uint8_t                     planned:1;
+
+  // NOTE: resolved once per fetch, with SQL_ATTR_ROW_BIND_OFFSET_PTR applied and strides taken from SQL_ATTR_ROW_BIND_TYPE
+  char                       *data;
+  char                       *str_len;
+  char                       *ind;
+  size_t                      data_stride;
+  size_t                      len_stride;
+  uint8_t                     by_slice:1;   // bulk-copied per block segment, see _stmt_fill_col_by_slice
+};
+
+struct cols_bind_meta_s {
+  col_bind_meta_t           *base;
+  size_t                     cap;
+  size_t                     nr;
+};
+
 typedef SQLRETURN (*param_bind_set_APD_record_f)(stmt_t* stmt,
     desc_record_t  *APD_record,
     SQLUSMALLINT    ParameterNumber,
@@ -1064,6 +1381,16 @@ struct ticks_s {
 };
 #endif                                   /* } */
 
+struct param_batcher_s {
+  size_t                     rows_max;      // BATCH_BYTES over the row width
+  size_t                     rows;          // target size of the next batch
+  size_t                     rows_last;     // size of the last batch executed, see SQL_ATTR_TAOS_INSERT_BATCH_ROWS
+  double                     rate;          // rows per second observed for the last full batch
+  int                        step;          // 1: growing, -1: shrinking
+
+  unsigned int               enabled:1;
+};
+
 struct stmt_s {
   atomic_int                 refc;
 
@@ -1088,12 +1415,14 @@ struct stmt_s {
   descriptor_t               ARD, IRD;
 
   params_bind_meta_t         params_bind_meta;
+  cols_bind_meta_t           cols_bind_meta;
 
   descriptor_t              *current_APD;
   descriptor_t              *current_ARD;
 
   get_data_ctx_t             get_data_ctx;
   param_state_t              param_state;
+  param_batcher_t            param_batcher;
 
   mem_t                      raw;
   sqls_t                     sqls;
@@ -1118,8 +1447,22 @@ struct stmt_s {
 
   unsigned int               strict:1; // 1: param-truncation as failure
   unsigned int               no_total:1;
+  unsigned int               pipelined_insert:1; // SQL_ATTR_TAOS_PIPELINED_INSERT
+  unsigned int               continue_on_error:1; // SQL_ATTR_TAOS_CONTINUE_ON_ERROR
   SQLULEN                    concurrency_attr;
+  SQLULEN                    query_timeout;       // SQL_ATTR_QUERY_TIMEOUT, in seconds
+  query_timer_t              query_timer;
+
+  // NOTE: see SQLCancel, in_flight while executing/fetching, cancelled is checked in between rows/batches/polls
+  atomic_int                 in_flight;
+  atomic_int                 cancelled;
   SQLULEN                    cursor_type;
+
+  // NOTE: static cursor positioning, 1-based as in ODBC, 0 for before-start
+  SQLLEN                     rowset_start;
+  size_t                     rowset_size;
+  unsigned int               rowset_after_end:1;
+  unsigned int               rowset_reseek:1;
 };
 
 struct tls_s {
@@ -28,7 +28,9 @@
 #include "columns.h"
 #include "conn.h"
 #include "desc.h"
+#include "env.h"
 #include "errs.h"
+#include "fmt.h"
 #include "log.h"
 #include "conn_parser.h"
 #include "ext_parser.h"
@@ -190,6 +192,38 @@ static int _params_bind_meta_set_adjust_conv(params_bind_meta_t *params_bind_met
   return 0;
 }
 
+static void _cols_bind_meta_reset(cols_bind_meta_t *cols_bind_meta)
+{
+  if (!cols_bind_meta) return;
+  if (cols_bind_meta->base) memset(cols_bind_meta->base, 0, sizeof(*cols_bind_meta->base) * cols_bind_meta->nr);
+
+  cols_bind_meta->nr = 0;
+}
+
+static void _cols_bind_meta_release(cols_bind_meta_t *cols_bind_meta)
+{
+  if (!cols_bind_meta) return;
+  _cols_bind_meta_reset(cols_bind_meta);
+
+  cols_bind_meta->cap = 0;
+  TOD_SAFE_FREE(cols_bind_meta->base);
+}
+
+static int _cols_bind_meta_keep(cols_bind_meta_t *cols_bind_meta, size_t cap)
+{
+  if (cap <= cols_bind_meta->cap) return 0;
+
+  cap = (cap + 15) / 16 * 16;
+  col_bind_meta_t *p = (col_bind_meta_t*)realloc(cols_bind_meta->base, cap * sizeof(*p));
+  if (!p) return -1;
+  memset(p + cols_bind_meta->nr, 0, sizeof(*p) * (cap - cols_bind_meta->nr));
+
+  cols_bind_meta->base = p;
+  cols_bind_meta->cap  = cap;
+
+  return 0;
+}
+
 static void _sqls_reset(sqls_t *sqls)
 {
   if (!sqls) return;
@@ -242,9 +276,20 @@ static void _param_state_reset(param_state_t *param_state)
   param_state->nr_batch_size    = 0;
   param_state->i_batch_offset   = 0;
 
+  param_state->subtbl_rows      = NULL;
+  mem_reset(&param_state->subtbl_plan);
+  mem_reset(&param_state->subtbl_names);
+  mem_reset(&param_state->subtbl_groups);
+  param_state->nr_subtbl_rows     = 0;
+  param_state->nr_subtbl_rejected = 0;
+
+  mem_reset(&param_state->row_skips);
+  param_state->nr_batch_skipped = 0;
+
   param_state->nr_tsdb_fields   = 0;
 
   param_state->i_row            = 0;
+  param_state->i_bind           = 0;
   param_state->i_param          = 0;
   param_state->APD_record       = NULL;
   param_state->IPD_record       = NULL;
@@ -260,10 +305,21 @@ static void _param_state_release(param_state_t *param_state)
   if (!param_state) return;
   _param_state_reset(param_state);
   mem_release(&param_state->tmp);
+  mem_release(&param_state->subtbl_plan);
+  mem_release(&param_state->subtbl_names);
+  mem_release(&param_state->subtbl_groups);
+  mem_release(&param_state->row_skips);
   _sqlc_data_release(&param_state->sqlc_data);
   _sql_data_release(&param_state->sql_data);
 }
 
+static size_t _param_state_row(const param_state_t *param_state, size_t i_bind)
+{
+  size_t i = param_state->i_batch_offset + i_bind;
+  if (param_state->subtbl_rows) return param_state->subtbl_rows[i].i_row;
+  return i;
+}
+
 static void _stmt_release_descriptors(stmt_t *stmt)
 {
   descriptor_release(&stmt->APD);
@@ -375,6 +431,11 @@ static void _stmt_reset_result(stmt_t *stmt)
   topic_reset(&stmt->topic);
 
   if (_stmt_get_rows_fetched_ptr(stmt)) *_stmt_get_rows_fetched_ptr(stmt) = 0;
+
+  stmt->rowset_start         = 0;
+  stmt->rowset_size          = 0;
+  stmt->rowset_after_end     = 0;
+  stmt->rowset_reseek        = 0;
 }
 
 static void _stmt_release_result(stmt_t *stmt)
@@ -582,12 +643,54 @@ static void _stmt_close_result(stmt_t *stmt)
   stmt->base = &stmt->tsdb_stmt.base;
 }
 
+static void _stmt_cancel_enter(stmt_t *stmt)
+{
+  atomic_store(&stmt->cancelled, 0);
+  atomic_store(&stmt->in_flight, 1);
+}
+
+static SQLRETURN _stmt_cancel_leave(stmt_t *stmt, SQLRETURN sr)
+{
+  atomic_store(&stmt->in_flight, 0);
+  if (sr != SQL_ERROR || !atomic_load(&stmt->cancelled)) return sr;
+
+  // NOTE: free the result as well, thus server-side resources are released rather than drained
+  _stmt_close_result(stmt);
+  stmt_clr_errs(stmt);
+  stmt_append_err(stmt, "HY008", 0, "Operation canceled");
+  return SQL_ERROR;
+}
+
+int stmt_is_cancelled(stmt_t *stmt)
+{
+  return !!atomic_load(&stmt->cancelled);
+}
+
+SQLRETURN stmt_cancel(stmt_t *stmt)
+{
+  // NOTE: nothing is running, which is a no-op as of ODBC 3.8
+  if (!atomic_load(&stmt->in_flight)) return SQL_SUCCESS;
+
+  atomic_store(&stmt->cancelled, 1);
+
+  // NOTE: taos_stop_query would race with the executing thread freeing the result, thus interrupt via the connection instead
+  //       taos_kill_query is connection-wide, thus requests in flight of other statements on the same connection are killed as well
+  //       applications that cancel shall run concurrent statements on separate connections
+  conn_t *conn = stmt->conn;
+  if (!conn_is_ws_backended(conn) && conn->ds_conn.taos) {
+    CALL_taos_kill_query((TAOS*)conn->ds_conn.taos);
+  }
+
+  return SQL_SUCCESS;
+}
+
 static void _stmt_unbind_cols(stmt_t *stmt)
 {
   descriptor_t *ARD = _stmt_ARD(stmt);
   desc_header_t *ARD_header = &ARD->header;
   ARD_header->DESC_COUNT = 0;
   memset(ARD->records, 0, sizeof(*ARD->records) * ARD->cap);
+  _cols_bind_meta_reset(&stmt->cols_bind_meta);
 }
 
 static void _stmt_reset_params(stmt_t *stmt)
@@ -739,6 +842,7 @@ static void _stmt_release(stmt_t *stmt)
   _sqls_release(&stmt->sqls);
   _param_state_release(&stmt->param_state);
   _params_bind_meta_release(&stmt->params_bind_meta);
+  _cols_bind_meta_release(&stmt->cols_bind_meta);
 #ifdef USE_TICK_TO_DEBUG                 /* { */
   _stmt_release_ticks(stmt);
 #endif                                   /* } */
@@ -1374,6 +1478,189 @@ static SQLRETURN _stmt_col_copy_string(
   return SQL_SUCCESS;
 }
 
+static SQLRETURN _stmt_get_data_copy_null(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  if (args->IndPtr) {
+    *args->IndPtr = SQL_NULL_DATA;
+    return SQL_SUCCESS;
+  }
+  stmt_append_err_format(stmt, "22002", 0, "Indicator variable required but not supplied:#%d Column_or_Param", args->Col_or_Param_Num);
+  return SQL_ERROR;
+}
+
+static SQLRETURN _stmt_col_copy_bool_to_bit(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(uint8_t*)args->TargetValuePtr = tsdb->b;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_i8_to_i8(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(int8_t*)args->TargetValuePtr = tsdb->i8;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_u8_to_u8(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(uint8_t*)args->TargetValuePtr = tsdb->u8;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_i16_to_i16(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(int16_t*)args->TargetValuePtr = tsdb->i16;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_u16_to_u16(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(uint16_t*)args->TargetValuePtr = tsdb->u16;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_i32_to_i32(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(int32_t*)args->TargetValuePtr = tsdb->i32;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_u32_to_u32(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(uint32_t*)args->TargetValuePtr = tsdb->u32;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_i64_to_i64(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(int64_t*)args->TargetValuePtr = tsdb->i64;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_u64_to_u64(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(uint64_t*)args->TargetValuePtr = tsdb->u64;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_flt_to_flt(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(float*)args->TargetValuePtr = tsdb->flt;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_dbl_to_dbl(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(double*)args->TargetValuePtr = tsdb->dbl;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_ts_to_i64(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  *(int64_t*)args->TargetValuePtr = tsdb->ts.ts;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_col_copy_ts_to_timestamp(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  tsdb_data_t *tsdb = &stmt->get_data_ctx.tsdb;
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
+  if (tsdb_timestamp_to_SQL_C_TYPE_TIMESTAMP(tsdb->ts.ts, tsdb->ts.precision, (SQL_TIMESTAMP_STRUCT*)args->TargetValuePtr)) {
+    stmt_append_err_format(stmt, "HY000", 0,
+        "General error:Column[%d] conversion from `%s[0x%x/%d]` to `%s[0x%x/%d]` failed",
+        args->Col_or_Param_Num, taos_data_type(tsdb->type), tsdb->type, tsdb->type,
+        sqlc_data_type(args->TargetType), args->TargetType, args->TargetType);
+    return SQL_ERROR;
+  }
+  return SQL_SUCCESS;
+}
+
+static const struct {
+  int8_t                      tsdb_type;
+  SQLSMALLINT                 TargetType;
+  col_f                       copy;
+} _col_copy_map[] = {
+  {TSDB_DATA_TYPE_BOOL,        SQL_C_BIT,               _stmt_col_copy_bool_to_bit},
+  {TSDB_DATA_TYPE_TINYINT,     SQL_C_TINYINT,           _stmt_col_copy_i8_to_i8},
+  {TSDB_DATA_TYPE_TINYINT,     SQL_C_STINYINT,          _stmt_col_copy_i8_to_i8},
+  {TSDB_DATA_TYPE_UTINYINT,    SQL_C_UTINYINT,          _stmt_col_copy_u8_to_u8},
+  {TSDB_DATA_TYPE_SMALLINT,    SQL_C_SHORT,             _stmt_col_copy_i16_to_i16},
+  {TSDB_DATA_TYPE_SMALLINT,    SQL_C_SSHORT,            _stmt_col_copy_i16_to_i16},
+  {TSDB_DATA_TYPE_USMALLINT,   SQL_C_USHORT,            _stmt_col_copy_u16_to_u16},
+  {TSDB_DATA_TYPE_INT,         SQL_C_LONG,              _stmt_col_copy_i32_to_i32},
+  {TSDB_DATA_TYPE_INT,         SQL_C_SLONG,             _stmt_col_copy_i32_to_i32},
+  {TSDB_DATA_TYPE_UINT,        SQL_C_ULONG,             _stmt_col_copy_u32_to_u32},
+  {TSDB_DATA_TYPE_BIGINT,      SQL_C_SBIGINT,           _stmt_col_copy_i64_to_i64},
+  {TSDB_DATA_TYPE_UBIGINT,     SQL_C_UBIGINT,           _stmt_col_copy_u64_to_u64},
+  {TSDB_DATA_TYPE_FLOAT,       SQL_C_FLOAT,             _stmt_col_copy_flt_to_flt},
+  {TSDB_DATA_TYPE_DOUBLE,      SQL_C_DOUBLE,            _stmt_col_copy_dbl_to_dbl},
+  {TSDB_DATA_TYPE_TIMESTAMP,   SQL_C_SBIGINT,           _stmt_col_copy_ts_to_i64},
+  {TSDB_DATA_TYPE_TIMESTAMP,   SQL_C_TYPE_TIMESTAMP,    _stmt_col_copy_ts_to_timestamp},
+};
+
+static col_bind_meta_t* _stmt_plan_col(stmt_t *stmt, size_t i_col, int8_t tsdb_type, SQLSMALLINT TargetType)
+{
+  cols_bind_meta_t *cols_bind_meta = &stmt->cols_bind_meta;
+  if (_cols_bind_meta_keep(cols_bind_meta, i_col + 1)) return NULL;
+  if (i_col >= cols_bind_meta->nr) cols_bind_meta->nr = i_col + 1;
+
+  col_bind_meta_t *meta = cols_bind_meta->base + i_col;
+  if (meta->planned && meta->tsdb_type == tsdb_type && meta->TargetType == TargetType) return meta;
+
+  meta->tsdb_type  = tsdb_type;
+  meta->TargetType = TargetType;
+  meta->copy       = NULL;
+  meta->planned    = 1;
+
+  for (size_t i=0; i<sizeof(_col_copy_map)/sizeof(_col_copy_map[0]); ++i) {
+    if (_col_copy_map[i].tsdb_type != tsdb_type || _col_copy_map[i].TargetType != TargetType) continue;
+    meta->copy = _col_copy_map[i].copy;
+    break;
+  }
+
+  return meta;
+}
+
+static void _stmt_plan_cols(stmt_t *stmt)
+{
+  descriptor_t *ARD = _stmt_ARD(stmt);
+  desc_header_t *ARD_header = &ARD->header;
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
+
+  _cols_bind_meta_reset(&stmt->cols_bind_meta);
+
+  for (int i_col = 0; i_col < ARD_header->DESC_COUNT && i_col < IRD_header->DESC_COUNT; ++i_col) {
+    desc_record_t *ARD_record = ARD->records + i_col;
+    if (!ARD_record->bound) continue;
+    desc_record_t *IRD_record = IRD->records + i_col;
+    _stmt_plan_col(stmt, i_col, IRD_record->tsdb_type, (SQLSMALLINT)ARD_record->DESC_CONCISE_TYPE);
+  }
+}
+
 static SQLRETURN _stmt_fill_IRD(stmt_t *stmt)
 {
   SQLRETURN sr = SQL_SUCCESS;
@@ -1494,6 +1781,8 @@ static SQLRETURN _stmt_fill_IRD(stmt_t *stmt)
     }
   }
 
+  _stmt_plan_cols(stmt);
+
   return SQL_SUCCESS;
 }
 
@@ -1592,11 +1881,6 @@ SQLRETURN stmt_get_col_count(stmt_t *stmt, SQLSMALLINT *col_count_ptr)
 
 static SQLRETURN _stmt_set_row_bind_type(stmt_t *stmt, SQLULEN row_bind_type)
 {
-  if (row_bind_type != SQL_BIND_BY_COLUMN) {
-    stmt_append_err(stmt, "HY000", 0, "General error:only `SQL_BIND_BY_COLUMN` is supported now");
-    return SQL_ERROR;
-  }
-
   descriptor_t *ARD = _stmt_ARD(stmt);
   desc_header_t *ARD_header = &ARD->header;
   ARD_header->DESC_BIND_TYPE = row_bind_type;
@@ -1750,20 +2034,67 @@ SQLRETURN stmt_bind_col(stmt_t *stmt,
   }
 
   // OW("Column%d:%s",  ColumnNumber, sqlc_data_type(TargetType));
-  return _stmt_bind_col(stmt, ColumnNumber, TargetType, TargetValuePtr, BufferLength, StrLen_or_IndPtr);
+  SQLRETURN sr = _stmt_bind_col(stmt, ColumnNumber, TargetType, TargetValuePtr, BufferLength, StrLen_or_IndPtr);
+  if (sr != SQL_SUCCESS) return sr;
+
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
+  if (TargetValuePtr && ColumnNumber <= IRD_header->DESC_COUNT) {
+    desc_record_t *IRD_record = IRD->records + ColumnNumber - 1;
+    _stmt_plan_col(stmt, ColumnNumber - 1, IRD_record->tsdb_type, TargetType);
+  }
+
+  return SQL_SUCCESS;
 }
 
-static SQLPOINTER _stmt_get_address(stmt_t *stmt, SQLPOINTER ptr, SQLULEN octet_length, size_t i_row, desc_header_t *header)
+static SQLRETURN _stmt_plan_col_addrs(stmt_t *stmt)
 {
-  (void)stmt;
-  if (ptr == NULL) return ptr;
+  descriptor_t *ARD = _stmt_ARD(stmt);
+  desc_header_t *ARD_header = &ARD->header;
+  cols_bind_meta_t *cols_bind_meta = &stmt->cols_bind_meta;
+
+  size_t nr_cols = ARD_header->DESC_COUNT;
+  if (nr_cols > ARD->cap) nr_cols = ARD->cap;
+  if (_cols_bind_meta_keep(cols_bind_meta, nr_cols)) {
+    stmt_oom(stmt);
+    return SQL_ERROR;
+  }
+  if (nr_cols > cols_bind_meta->nr) cols_bind_meta->nr = nr_cols;
+
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
+
+  SQLULEN offset    = ARD_header->DESC_BIND_OFFSET_PTR ? *ARD_header->DESC_BIND_OFFSET_PTR : 0;
+  SQLULEN bind_type = ARD_header->DESC_BIND_TYPE;
+
+  for (size_t i_col = 0; i_col < nr_cols; ++i_col) {
+    desc_record_t *ARD_record = ARD->records + i_col;
+    col_bind_meta_t *meta = cols_bind_meta->base + i_col;
+
+    // NOTE: planned by _stmt_fill_IRD/stmt_bind_col already, this only catches ARD changed via SQLSetDescField
+    if (ARD_record->bound && i_col < (size_t)IRD_header->DESC_COUNT) {
+      _stmt_plan_col(stmt, i_col, IRD->records[i_col].tsdb_type, (SQLSMALLINT)ARD_record->DESC_CONCISE_TYPE);
+    }
+
+    meta->data     = ARD_record->DESC_DATA_PTR ? (char*)ARD_record->DESC_DATA_PTR + offset : NULL;
+    meta->str_len  = ARD_record->DESC_OCTET_LENGTH_PTR ? (char*)ARD_record->DESC_OCTET_LENGTH_PTR + offset : NULL;
+    meta->ind      = ARD_record->DESC_INDICATOR_PTR ? (char*)ARD_record->DESC_INDICATOR_PTR + offset : NULL;
 
-  char *base = (char*)ptr;
-  if (header->DESC_BIND_OFFSET_PTR) base += *header->DESC_BIND_OFFSET_PTR;
+    if (bind_type == SQL_BIND_BY_COLUMN) {
+      meta->data_stride = (size_t)ARD_record->DESC_OCTET_LENGTH;
+      meta->len_stride  = sizeof(SQLLEN);
+    } else {
+      meta->data_stride = (size_t)bind_type;
+      meta->len_stride  = (size_t)bind_type;
+    }
+  }
 
-  char *dest = base + octet_length * i_row;
+  return SQL_SUCCESS;
+}
 
-  return dest;
+static char* _col_bind_meta_addr(char *base, size_t stride, size_t i_row)
+{
+  return base ? base + stride * i_row : NULL;
 }
 
 SQLRETURN stmt_get_diag_rec(
@@ -1778,6 +2109,45 @@ SQLRETURN stmt_get_diag_rec(
   return errs_get_diag_rec(&stmt->errs, RecNumber, SQLState, NativeErrorPtr, MessageText, BufferLength, TextLengthPtr);
 }
 
+static int _charset_is_ascii_compatible(const char *charset)
+{
+  const char *wides[] = {"UTF-16", "UTF-32", "UCS-2", "UCS-4", "UTF16", "UTF32", "UCS2", "UCS4"};
+  for (size_t i=0; i<sizeof(wides)/sizeof(wides[0]); ++i) {
+    if (tod_strncasecmp(charset, wides[i], strlen(wides[i])) == 0) return 0;
+  }
+  return 1;
+}
+
+static char* _stmt_get_data_fmt_target(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  // NOTE: formatted numbers/timestamps are pure ascii, thus go straight into the application's buffer if it's known to fit
+  switch (args->TargetType) {
+    case SQL_C_CHAR:
+      if (args->BufferLength <= FMT_MAX) return NULL;
+      if (!_charset_is_ascii_compatible(conn_get_sqlc_charset_for_col_bind(stmt->conn))) return NULL;
+      return (char*)args->TargetValuePtr;
+    case SQL_C_WCHAR:
+      if (args->BufferLength < (FMT_MAX + 1) * 2) return NULL;
+      return (char*)args->TargetValuePtr;
+    default:
+      return NULL;
+  }
+}
+
+static SQLRETURN _stmt_get_data_fmt_done(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  get_data_ctx_t *ctx = &stmt->get_data_ctx;
+
+  size_t n = ctx->nr;
+  if (args->TargetType == SQL_C_WCHAR) n = fmt_widen_utf16le((char*)args->TargetValuePtr, n);
+
+  ctx->pos = (const char*)-1;
+  ctx->nr  = 0;
+  if (args->IndPtr) *args->IndPtr = 0;
+  if (args->StrLenPtr) *args->StrLenPtr = n;
+  return SQL_SUCCESS;
+}
+
 static SQLRETURN _stmt_get_data_prepare_ctx(stmt_t *stmt, stmt_get_data_args_t *args)
 {
   SQLRETURN sr = SQL_SUCCESS;
@@ -1785,6 +2155,9 @@ static SQLRETURN _stmt_get_data_prepare_ctx(stmt_t *stmt, stmt_get_data_args_t *
   get_data_ctx_t *ctx = &stmt->get_data_ctx;
   tsdb_data_t *tsdb = &ctx->tsdb;
 
+  ctx->pos = NULL;
+  ctx->nr  = 0;
+
   sr = stmt->base->get_data(stmt->base, args->Col_or_Param_Num, tsdb);
   if (sr != SQL_SUCCESS) return SQL_ERROR;
 
@@ -1804,70 +2177,70 @@ static SQLRETURN _stmt_get_data_prepare_ctx(stmt_t *stmt, stmt_get_data_args_t *
 
   if (target_is_fix) return SQL_SUCCESS;
 
+  char *out = _stmt_get_data_fmt_target(stmt, args);
+  char *buf = out ? out : ctx->buf;
+
   switch(tsdb->type) {
     case TSDB_DATA_TYPE_BOOL:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%s", tsdb->b ? "true" : "false");
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = tsdb->b ? 4 : 5;
+      memcpy(buf, tsdb->b ? "true" : "false", ctx->nr + 1);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_TINYINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%d", tsdb->i8);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_int64(buf, tsdb->i8);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_UTINYINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%u", tsdb->u8);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_uint64(buf, tsdb->u8);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_SMALLINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%d", tsdb->i16);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_int64(buf, tsdb->i16);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_USMALLINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%u", tsdb->u16);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_uint64(buf, tsdb->u16);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_INT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%d", tsdb->i32);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_int64(buf, tsdb->i32);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_UINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%u", tsdb->u32);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_uint64(buf, tsdb->u32);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_BIGINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%" PRId64 "", tsdb->i64);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_int64(buf, tsdb->i64);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_UBIGINT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%" PRIu64 "", tsdb->u64);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_uint64(buf, tsdb->u64);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_FLOAT:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%g", (double)tsdb->flt);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_float(buf, tsdb->flt);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_DOUBLE:
-      {
-        ctx->nr = snprintf(ctx->buf, sizeof(ctx->buf), "%g", tsdb->dbl);
-        ctx->pos = ctx->buf;
-      } break;
+      ctx->nr = fmt_double(buf, tsdb->dbl);
+      ctx->pos = buf;
+      break;
     case TSDB_DATA_TYPE_VARCHAR:
       ctx->nr = tsdb->str.len;
       ctx->pos = tsdb->str.str;
       break;
     case TSDB_DATA_TYPE_TIMESTAMP:
       {
-        ctx->nr = tsdb_timestamp_to_string(tsdb->ts.ts, tsdb->ts.precision, (char*)ctx->buf, sizeof(ctx->buf));
-        ctx->pos = ctx->buf;
+        int n = tsdb_timestamp_to_string(tsdb->ts.ts, tsdb->ts.precision, buf, FMT_MAX + 1);
+        if (n < 0) {
+          stmt_append_err_format(stmt, "HY000", 0,
+              "General error:Column[%d] conversion from `%s[0x%x/%d]` failed",
+              args->Col_or_Param_Num, taos_data_type(tsdb->type), tsdb->type, tsdb->type);
+          return SQL_ERROR;
+        }
+        ctx->nr = n;
+        ctx->pos = buf;
       } break;
     case TSDB_DATA_TYPE_NCHAR:
       ctx->nr = tsdb->str.len;
@@ -1892,6 +2265,8 @@ static SQLRETURN _stmt_get_data_prepare_ctx(stmt_t *stmt, stmt_get_data_args_t *
       return SQL_ERROR;
   }
 
+  if (out && ctx->pos == out) return _stmt_get_data_fmt_done(stmt, args);
+
   return SQL_SUCCESS;
 }
 
@@ -2136,37 +2511,21 @@ static SQLRETURN _stmt_get_data_copy_buf_to_char(stmt_t *stmt, stmt_get_data_arg
   return SQL_SUCCESS;
 }
 
-static SQLRETURN _stmt_get_data_copy_buf_to_wchar(stmt_t *stmt, stmt_get_data_args_t *args)
+static int _stmt_utf8_remains(stmt_t *stmt, const char *s, size_t n, size_t *nr_remains)
 {
-  int r = 0;
-  SQLRETURN sr = SQL_SUCCESS;
+  // NOTE: no need to count if SQL_NO_TOTAL is what to report
+  if (stmt->no_total) return 0;
+  size_t bytes = 0;
+  if (charset_utf8_utf16le_bytes(s, n, &bytes)) return -1;
+  *nr_remains += bytes;
+  return 0;
+}
 
+static int _stmt_get_data_copy_utf8_to_wchar(stmt_t *stmt, stmt_get_data_args_t *args, SQLRETURN *psr)
+{
+  // NOTE: built-in UTF-8 => UTF-16LE, which converts and counts in one pass, rather than iconv_calc + iconv
+  //       returns -1 if invalid utf-8 encountered, and leaves everything untouched, thus iconv would report in detail
   get_data_ctx_t *ctx = &stmt->get_data_ctx;
-  tsdb_data_t *tsdb = &ctx->tsdb;
-  if (ctx->pos == (const char*)-1) return SQL_NO_DATA;
-
-  const char *fromcode = conn_get_tsdb_charset(stmt->conn);
-  const char *tocode   = "UTF-16LE";
-
-  if (tsdb->type == TSDB_DATA_TYPE_NCHAR && tsdb->str.encoder) {
-    fromcode = tsdb->str.encoder;
-  }
-
-  charset_conv_t *cnv  = tls_get_charset_conv(fromcode, tocode);
-  if (!cnv) {
-    stmt_append_err_format(stmt, "HY000", 0, "General error:conversion for `%s` to `%s` not found or out of memory", fromcode, tocode);
-    return SQL_ERROR;
-  }
-
-  // NOTE: calculate remaining bytes in whole-characters
-  size_t nr_remains = 0;  // NOTE: store as StrLen_or_Ind when SQL_SUCCESS_WITH_INFO
-  r = iconv_calc(cnv->cnv, ctx->pos, ctx->nr, &nr_remains);
-  if (r) {
-    stmt_append_err_format(stmt, "HY000", 0,
-        "General error:[iconv]Character set conversion for `%s` to `%s` failed",
-        cnv->from, cnv->to);
-    return SQL_ERROR;
-  }
 
   size_t      curr        = ctx->curr;
   size_t      end         = ctx->end;
@@ -2174,11 +2533,145 @@ static SQLRETURN _stmt_get_data_copy_buf_to_wchar(stmt_t *stmt, stmt_get_data_ar
   SQLLEN      buffer_len  = args->BufferLength;
   const char *residual    = ctx->residual;
 
-  nr_remains += end - curr;
+  size_t nr_remains = end - curr;
 
   if (buffer_len <= 2) {
+    if (_stmt_utf8_remains(stmt, ctx->pos, ctx->nr, &nr_remains)) return -1;
     if (buffer_len == 2) ((uint16_t*)args->TargetValuePtr)[0] = 0;
-    return _stmt_return_SQL_SUCCESS_WITH_INFO(stmt, args, nr_remains);
+    *psr = _stmt_return_SQL_SUCCESS_WITH_INFO(stmt, args, nr_remains);
+    return 0;
+  }
+
+  if (curr < end) {
+    // NOTE: flushing residual
+    size_t n = end - curr;
+    if (n > (size_t)buffer_len - 2) {
+      // NOTE: too big to flush all
+      if (_stmt_utf8_remains(stmt, ctx->pos, ctx->nr, &nr_remains)) return -1;
+      n = (buffer_len - 2) / 2 * 2;
+      memcpy(target_ptr, residual + curr, n);
+      ctx->curr += n;
+      *(uint16_t*)(target_ptr+n) = 0;
+      *psr = _stmt_return_SQL_SUCCESS_WITH_INFO(stmt, args, nr_remains);
+      return 0;
+    }
+    memcpy(target_ptr, residual + curr, n);
+
+    curr            += n;
+    target_ptr      += n;
+    buffer_len      -= n;
+  }
+
+  const char      *inbuf               = ctx->pos;
+  size_t           inbytesleft         = ctx->nr;
+  char            *outbuf              = (char*)target_ptr;
+  size_t           outbytesleft        = buffer_len - 2; // NOTE: leaving room for null-terminator
+
+  int r = charset_utf8_to_utf16le(&inbuf, &inbytesleft, &outbuf, &outbytesleft);
+  if (r < 0) return -1;
+
+  size_t nr_produced = (size_t)(outbuf - (char*)target_ptr);
+
+  if (r == 1) {
+    // NOTE: next character does not fit, convert it alone and store it as residual
+    unsigned char c = (unsigned char)*inbuf;
+    size_t len = (c < 0x80) ? 1 : (c < 0xe0) ? 2 : (c < 0xf0) ? 3 : 4;
+    if (len > inbytesleft) return -1;
+
+    // NOTE: validate the tail first, thus ctx->residual is still intact if it falls back to iconv
+    if (_stmt_utf8_remains(stmt, inbuf + len, inbytesleft - len, &nr_remains)) return -1;
+
+    const char *in      = inbuf;
+    size_t      inlen   = len;
+    char       *out     = ctx->residual;
+    size_t      outlen  = sizeof(ctx->residual);
+    if (charset_utf8_to_utf16le(&in, &inlen, &out, &outlen)) return -1;
+
+    size_t nr_residual = sizeof(ctx->residual) - outlen;
+    nr_remains += nr_produced + nr_residual;
+
+    ctx->curr = 0;
+    ctx->end  = nr_residual;
+
+    size_t n = nr_residual;
+    if (n > outbytesleft / 2 * 2) n = outbytesleft / 2 * 2;
+    memcpy(outbuf, ctx->residual, n);
+    outbuf    += n;
+    ctx->curr  = n;
+
+    inbuf        = in;
+    inbytesleft -= len;
+  } else {
+    ctx->curr = ctx->end;
+  }
+
+  size_t n = ctx->nr - inbytesleft;
+  ctx->pos  += n;
+  ctx->nr   -= n;
+
+  size_t nr_converted = outbuf - (char*)args->TargetValuePtr;
+
+  *(uint16_t*)outbuf   = 0;
+
+  if (ctx->nr || ctx->curr < ctx->end) {
+    *psr = _stmt_return_SQL_SUCCESS_WITH_INFO(stmt, args, nr_remains);
+    return 0;
+  }
+
+  ctx->pos = (const char*)-1;
+  if (args->IndPtr) *args->IndPtr = 0; // FIXME:
+  if (args->StrLenPtr) *args->StrLenPtr = nr_converted;
+  *psr = SQL_SUCCESS;
+  return 0;
+}
+
+static SQLRETURN _stmt_get_data_copy_buf_to_wchar(stmt_t *stmt, stmt_get_data_args_t *args)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  get_data_ctx_t *ctx = &stmt->get_data_ctx;
+  tsdb_data_t *tsdb = &ctx->tsdb;
+  if (ctx->pos == (const char*)-1) return SQL_NO_DATA;
+
+  const char *fromcode = conn_get_tsdb_charset(stmt->conn);
+  const char *tocode   = "UTF-16LE";
+
+  if (tsdb->type == TSDB_DATA_TYPE_NCHAR && tsdb->str.encoder) {
+    fromcode = tsdb->str.encoder;
+  }
+
+  if (charset_is_utf8(fromcode)) {
+    if (_stmt_get_data_copy_utf8_to_wchar(stmt, args, &sr) == 0) return sr;
+  }
+
+  charset_conv_t *cnv  = tls_get_charset_conv(fromcode, tocode);
+  if (!cnv) {
+    stmt_append_err_format(stmt, "HY000", 0, "General error:conversion for `%s` to `%s` not found or out of memory", fromcode, tocode);
+    return SQL_ERROR;
+  }
+
+  // NOTE: calculate remaining bytes in whole-characters
+  size_t nr_remains = 0;  // NOTE: store as StrLen_or_Ind when SQL_SUCCESS_WITH_INFO
+  r = iconv_calc(cnv->cnv, ctx->pos, ctx->nr, &nr_remains);
+  if (r) {
+    stmt_append_err_format(stmt, "HY000", 0,
+        "General error:[iconv]Character set conversion for `%s` to `%s` failed",
+        cnv->from, cnv->to);
+    return SQL_ERROR;
+  }
+
+  size_t      curr        = ctx->curr;
+  size_t      end         = ctx->end;
+  uint8_t    *target_ptr  = (uint8_t*)args->TargetValuePtr;
+  SQLLEN      buffer_len  = args->BufferLength;
+  const char *residual    = ctx->residual;
+
+  nr_remains += end - curr;
+
+  if (buffer_len <= 2) {
+    if (buffer_len == 2) ((uint16_t*)args->TargetValuePtr)[0] = 0;
+    return _stmt_return_SQL_SUCCESS_WITH_INFO(stmt, args, nr_remains);
   }
 
   size_t nr_copied_residual = 0;
@@ -3043,14 +3536,7 @@ static SQLRETURN _stmt_get_data_copy(stmt_t *stmt, stmt_get_data_args_t *args)
   get_data_ctx_t *ctx = &stmt->get_data_ctx;
   tsdb_data_t *tsdb = &ctx->tsdb;
 
-  if (tsdb->is_null) {
-    if (args->IndPtr) {
-      *args->IndPtr = SQL_NULL_DATA;
-      return SQL_SUCCESS;
-    }
-    stmt_append_err_format(stmt, "22002", 0, "Indicator variable required but not supplied:#%d Column_or_Param", args->Col_or_Param_Num);
-    return SQL_ERROR;
-  }
+  if (tsdb->is_null) return _stmt_get_data_copy_null(stmt, args);
 
   switch(tsdb->type) {
     case TSDB_DATA_TYPE_BOOL:
@@ -3107,6 +3593,8 @@ static SQLRETURN _stmt_get_data_x(stmt_t *stmt, stmt_get_data_args_t *args)
 
     sr = _stmt_get_data_prepare_ctx(stmt, args);
     if (sr != SQL_SUCCESS) return SQL_ERROR;
+    // NOTE: already formatted into the application's buffer
+    if (ctx->pos == (const char*)-1) return SQL_SUCCESS;
   }
 
   if (ctx->TargetType != args->TargetType) {
@@ -3203,9 +3691,10 @@ static SQLRETURN _stmt_fill_col(stmt_t *stmt, size_t i_row, size_t i_col)
   desc_record_t *ARD_record = ARD->records + i_col;
   if (ARD_record->DESC_DATA_PTR == NULL) return SQL_SUCCESS;
 
-  char *dest = _stmt_get_address(stmt, ARD_record->DESC_DATA_PTR, ARD_record->DESC_OCTET_LENGTH, i_row, ARD_header);
-  SQLLEN *StrLenPtr = _stmt_get_address(stmt, ARD_record->DESC_OCTET_LENGTH_PTR, sizeof(SQLLEN), i_row, ARD_header);
-  SQLLEN *IndPtr = _stmt_get_address(stmt, ARD_record->DESC_INDICATOR_PTR, sizeof(SQLLEN), i_row, ARD_header);
+  col_bind_meta_t *addrs = stmt->cols_bind_meta.base + i_col;
+  char *dest = _col_bind_meta_addr(addrs->data, addrs->data_stride, i_row);
+  SQLLEN *StrLenPtr = (SQLLEN*)_col_bind_meta_addr(addrs->str_len, addrs->len_stride, i_row);
+  SQLLEN *IndPtr = (SQLLEN*)_col_bind_meta_addr(addrs->ind, addrs->len_stride, i_row);
 
   SQLSMALLINT    TargetType       = (SQLSMALLINT)ARD_record->DESC_CONCISE_TYPE;
   SQLPOINTER     TargetValuePtr   = dest;
@@ -3220,6 +3709,13 @@ static SQLRETURN _stmt_fill_col(stmt_t *stmt, size_t i_row, size_t i_col)
     .IndPtr                     = IndPtr,
   };
 
+  // NOTE: planned once per fetch by _stmt_plan_col_addrs, thus only dispatched here
+  if (addrs->planned && addrs->copy && addrs->TargetType == TargetType) {
+    SQLRETURN sr = stmt->base->get_data(stmt->base, args.Col_or_Param_Num, &stmt->get_data_ctx.tsdb);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+    return addrs->copy(stmt, &args);
+  }
+
   return _stmt_get_data_x(stmt, &args);
 }
 
@@ -3237,6 +3733,7 @@ static SQLRETURN _stmt_fill_row(stmt_t *stmt, size_t i_row)
     desc_record_t *ARD_record = ARD->records + i_col;
     if (!ARD_record->bound) continue;
     if (ARD_record->DESC_DATA_PTR == NULL) continue;
+    if (stmt->cols_bind_meta.base[i_col].by_slice) continue;
 
     sr = _stmt_fill_col(stmt, i_row, i_col);
 
@@ -3251,6 +3748,208 @@ static SQLRETURN _stmt_fill_row(stmt_t *stmt, size_t i_row)
   return with_info ? SQL_SUCCESS_WITH_INFO : SQL_SUCCESS;
 }
 
+static size_t _stmt_col_slice_width(int8_t tsdb_type, SQLSMALLINT TargetType)
+{
+  switch (tsdb_type) {
+    case TSDB_DATA_TYPE_INT:
+      if (TargetType == SQL_C_LONG || TargetType == SQL_C_SLONG) return sizeof(int32_t);
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      if (TargetType == SQL_C_ULONG) return sizeof(uint32_t);
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+      if (TargetType == SQL_C_SBIGINT) return sizeof(int64_t);
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      if (TargetType == SQL_C_UBIGINT) return sizeof(uint64_t);
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      if (TargetType == SQL_C_FLOAT) return sizeof(float);
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      if (TargetType == SQL_C_DOUBLE) return sizeof(double);
+      break;
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      if (TargetType == SQL_C_SBIGINT) return sizeof(int64_t);
+      if (TargetType == SQL_C_TYPE_TIMESTAMP) return sizeof(SQL_TIMESTAMP_STRUCT);
+      break;
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+static int _stmt_plan_cols_by_slice(stmt_t *stmt)
+{
+  if (!stmt->base || !stmt->base->fetch_rows_slice) return 0;
+#ifdef HAVE_TAOSWS           /* [ */
+  if (stmt->conn->cfg.url) return 0;
+#endif                       /* ] */
+
+  descriptor_t *ARD = _stmt_ARD(stmt);
+  desc_header_t *ARD_header = &ARD->header;
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
+
+  for (int i_col = 0; (size_t)i_col < ARD->cap; ++i_col) {
+    if (i_col >= ARD_header->DESC_COUNT) continue;
+    desc_record_t *ARD_record = ARD->records + i_col;
+    col_bind_meta_t *meta = stmt->cols_bind_meta.base + i_col;
+    meta->by_slice = 0;
+    if (!ARD_record->bound) continue;
+    if (ARD_record->DESC_DATA_PTR == NULL) continue;
+    if (i_col >= IRD_header->DESC_COUNT) continue;
+    // NOTE: row-wise bound rowsets are filled row by row, struct by struct
+    if (ARD_header->DESC_BIND_TYPE != SQL_BIND_BY_COLUMN) continue;
+
+    desc_record_t *IRD_record = IRD->records + i_col;
+    size_t width = _stmt_col_slice_width(IRD_record->tsdb_type, (SQLSMALLINT)ARD_record->DESC_CONCISE_TYPE);
+    if (width == 0) continue;
+    if ((size_t)ARD_record->DESC_OCTET_LENGTH != width) continue;
+    if (!ARD_record->DESC_INDICATOR_PTR && IRD_record->DESC_NULLABLE != SQL_NO_NULLS) continue;
+    meta->by_slice = 1;
+  }
+
+  return 1;
+}
+
+static SQLRETURN _stmt_fill_col_by_slice(stmt_t *stmt, tsdb_rows_slice_t *slice, size_t i_row, size_t i_col)
+{
+  descriptor_t *ARD = _stmt_ARD(stmt);
+  desc_record_t *ARD_record = ARD->records + i_col;
+
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_record_t *IRD_record = IRD->records + i_col;
+
+  tsdb_res_t *res = slice->res;
+
+  SQLSMALLINT TargetType = (SQLSMALLINT)ARD_record->DESC_CONCISE_TYPE;
+  size_t width = _stmt_col_slice_width(IRD_record->tsdb_type, TargetType);
+
+  col_bind_meta_t *addrs = stmt->cols_bind_meta.base + i_col;
+  char *dest = _col_bind_meta_addr(addrs->data, addrs->data_stride, i_row);
+  SQLLEN *StrLenPtr = (SQLLEN*)_col_bind_meta_addr(addrs->str_len, addrs->len_stride, i_row);
+  SQLLEN *IndPtr = (SQLLEN*)_col_bind_meta_addr(addrs->ind, addrs->len_stride, i_row);
+
+  const bool *nulls = NULL;
+  if (IRD_record->DESC_NULLABLE != SQL_NO_NULLS) {
+    nulls = tsdb_res_get_col_nulls(res, (int)i_col);
+    if (!nulls) {
+      stmt_oom(stmt);
+      return SQL_ERROR;
+    }
+  }
+
+  for (size_t i=0; i<slice->nr; ++i) {
+    int is_null = nulls && nulls[slice->i_row + i];
+    if (IndPtr) IndPtr[i] = is_null ? SQL_NULL_DATA : 0;
+    if (StrLenPtr && !is_null) StrLenPtr[i] = (SQLLEN)width;
+  }
+
+  const char *src = (const char*)res->rows_block.rows[i_col];
+
+  if (TargetType != SQL_C_TYPE_TIMESTAMP) {
+    // NOTE: values of null cells are copied as well, but never looked at by the application
+    memcpy(dest, src + slice->i_row * width, slice->nr * width);
+    return SQL_SUCCESS;
+  }
+
+  const int64_t *ts = (const int64_t*)src + slice->i_row;
+  SQL_TIMESTAMP_STRUCT *v = (SQL_TIMESTAMP_STRUCT*)dest;
+  for (size_t i=0; i<slice->nr; ++i) {
+    if (IndPtr && IndPtr[i] == SQL_NULL_DATA) continue;
+    if (tsdb_timestamp_to_SQL_C_TYPE_TIMESTAMP(ts[i], res->time_precision, v + i)) {
+      stmt_append_err_format(stmt, "HY000", 0,
+          "General error:Column[%zd] conversion from `%s[0x%x/%d]` to `%s[0x%x/%d]` failed",
+          i_col + 1, taos_data_type(IRD_record->tsdb_type), IRD_record->tsdb_type, IRD_record->tsdb_type,
+          sqlc_data_type(TargetType), TargetType, TargetType);
+      return SQL_ERROR;
+    }
+  }
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_fill_rows_by_slice(stmt_t *stmt, tsdb_rows_slice_t *slice, size_t i_row)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  descriptor_t *ARD = _stmt_ARD(stmt);
+  desc_header_t *ARD_header = &ARD->header;
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
+
+  int nr_generic = 0;
+
+  for (int i_col = 0; (size_t)i_col < ARD->cap; ++i_col) {
+    if (i_col >= ARD_header->DESC_COUNT) continue;
+    desc_record_t *ARD_record = ARD->records + i_col;
+    if (!ARD_record->bound) continue;
+    if (ARD_record->DESC_DATA_PTR == NULL) continue;
+    if (!stmt->cols_bind_meta.base[i_col].by_slice) {
+      ++nr_generic;
+      continue;
+    }
+
+    sr = _stmt_fill_col_by_slice(stmt, slice, i_row, i_col);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+  }
+
+  for (size_t i=0; i<slice->nr; ++i) {
+    SQLRETURN sr_row = SQL_ROW_SUCCESS;
+    if (nr_generic) {
+      tsdb_rows_slice_seek(slice, i);
+      sr = _stmt_fill_row(stmt, i_row + i);
+      switch (sr) {
+        case SQL_SUCCESS:
+          sr_row = SQL_ROW_SUCCESS;
+          break;
+        case SQL_SUCCESS_WITH_INFO:
+          sr_row = SQL_ROW_SUCCESS_WITH_INFO;
+          break;
+        default:
+          sr_row = SQL_ROW_ERROR;
+          break;
+      }
+    }
+    if (IRD_header->DESC_ARRAY_STATUS_PTR) {
+      IRD_header->DESC_ARRAY_STATUS_PTR[i_row + i] = sr_row;
+    }
+  }
+
+  if (nr_generic) tsdb_rows_slice_seek(slice, slice->nr - 1);
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_fetch_rows_by_slice(stmt_t *stmt, const size_t row_array_size, size_t *nr_rows)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  size_t i_row = 0;
+
+  *nr_rows = 0;
+
+  // NOTE: a rowset is assembled from as many block segments as needed, thus always full-width unless eof
+  while (i_row < row_array_size) {
+    if (atomic_load(&stmt->cancelled)) return SQL_ERROR;
+    tsdb_rows_slice_t slice = {0};
+    sr = stmt->base->fetch_rows_slice(stmt->base, row_array_size - i_row, &slice);
+    if (sr == SQL_NO_DATA) break;
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+    sr = _stmt_fill_rows_by_slice(stmt, &slice, i_row);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+    i_row += slice.nr;
+    *nr_rows = i_row;
+  }
+
+  if (*nr_rows == 0) return SQL_NO_DATA;
+  return SQL_SUCCESS;
+}
+
 static SQLRETURN _stmt_fetch_rows(stmt_t *stmt, const size_t row_array_size, size_t *nr_rows)
 {
   SQLRETURN sr = SQL_SUCCESS;
@@ -3259,12 +3958,18 @@ static SQLRETURN _stmt_fetch_rows(stmt_t *stmt, const size_t row_array_size, siz
   descriptor_t *IRD = _stmt_IRD(stmt);
   desc_header_t *IRD_header = &IRD->header;
 
+  if (_stmt_plan_cols_by_slice(stmt)) {
+    return _stmt_fetch_rows_by_slice(stmt, row_array_size, nr_rows);
+  }
+
   size_t i_row = 0;
 
   *nr_rows = 0;
 
 again:
 
+  if (atomic_load(&stmt->cancelled)) return SQL_ERROR;
+
   sr = _stmt_fetch_row(stmt);
   if (sr == SQL_NO_DATA) {
     if (*nr_rows == 0) return SQL_NO_DATA;
@@ -3308,6 +4013,9 @@ static SQLRETURN _stmt_fetch_x(stmt_t *stmt)
   size_t row_array_size = _stmt_get_row_array_size(stmt);
   if (row_array_size == 0) row_array_size = 1;
 
+  sr = _stmt_plan_col_addrs(stmt);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
   size_t nr_rows = 0;
   sr = _stmt_fetch_rows(stmt, row_array_size, &nr_rows);
 
@@ -3327,45 +4035,212 @@ static SQLRETURN _stmt_fetch_x(stmt_t *stmt)
 
 static SQLRETURN _stmt_fetch(stmt_t *stmt)
 {
+  SQLRETURN sr = SQL_SUCCESS;
+
   _get_data_ctx_reset(&stmt->get_data_ctx);
 
-  descriptor_t *ARD = _stmt_ARD(stmt);
-  desc_header_t *ARD_header = &ARD->header;
+  if (stmt->rowset_reseek) {
+    // NOTE: previous scroll left the cursor before start, rewind to the first row
+    sr = stmt->base->seek_row(stmt->base, 0);
+    if (sr != SQL_SUCCESS && sr != SQL_NO_DATA) return SQL_ERROR;
+    stmt->rowset_reseek = 0;
+  }
 
-  if (ARD_header->DESC_BIND_TYPE != SQL_BIND_BY_COLUMN) {
-    stmt_append_err(stmt, "HY000", 0, "General error:only `SQL_BIND_BY_COLUMN` is supported now");
-    return SQL_ERROR;
+  size_t row_array_size = _stmt_get_row_array_size(stmt);
+  if (row_array_size == 0) row_array_size = 1;
+
+  sr = _stmt_fetch_x(stmt);
+  if (sr == SQL_NO_DATA) {
+    stmt->rowset_after_end = 1;
+    return SQL_NO_DATA;
   }
+  if (sr == SQL_ERROR) return SQL_ERROR;
 
-  return _stmt_fetch_x(stmt);
+  stmt->rowset_start = stmt->rowset_start ? stmt->rowset_start + (SQLLEN)stmt->rowset_size : 1;
+  stmt->rowset_size  = row_array_size;
+
+  return sr;
 }
 
-SQLRETURN stmt_fetch_scroll(stmt_t *stmt,
-    SQLSMALLINT   FetchOrientation,
-    SQLLEN        FetchOffset)
+static SQLRETURN _stmt_fetch_before_start(stmt_t *stmt)
 {
-  _get_data_ctx_reset(&stmt->get_data_ctx);
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
 
-  switch (FetchOrientation) {
-    case SQL_FETCH_NEXT:
-      (void)FetchOffset;
-      return _stmt_fetch(stmt);
-    default:
-      stmt_append_err_format(stmt, "HY000", 0,
-          "General error:[%s] not implemented yet",
-          sql_fetch_orientation(FetchOrientation));
-      return SQL_ERROR;
-  }
-}
+  if (IRD_header->DESC_ROWS_PROCESSED_PTR) *IRD_header->DESC_ROWS_PROCESSED_PTR = 0;
 
-SQLRETURN stmt_fetch(stmt_t *stmt)
-{
-  return stmt_fetch_scroll(stmt, SQL_FETCH_NEXT, 0);
+  stmt->rowset_start     = 0;
+  stmt->rowset_size      = 0;
+  stmt->rowset_after_end = 0;
+  stmt->rowset_reseek    = 1;
+
+  return SQL_NO_DATA;
 }
 
-static SQLRETURN _stmt_prepare(stmt_t *stmt)
+static SQLRETURN _stmt_fetch_after_end(stmt_t *stmt)
 {
-  return stmt->base->prepare(stmt->base, &stmt->current_sql);
+  SQLRETURN sr = SQL_SUCCESS;
+
+  descriptor_t *IRD = _stmt_IRD(stmt);
+  desc_header_t *IRD_header = &IRD->header;
+
+  if (IRD_header->DESC_ROWS_PROCESSED_PTR) *IRD_header->DESC_ROWS_PROCESSED_PTR = 0;
+
+  // NOTE: positions the underlying cursor past the last row, thus subsequent SQLGetData/SQL_FETCH_NEXT report no data
+  sr = stmt->base->seek_row(stmt->base, SIZE_MAX);
+  if (sr != SQL_SUCCESS && sr != SQL_NO_DATA) return SQL_ERROR;
+
+  stmt->rowset_start     = 0;
+  stmt->rowset_size      = 0;
+  stmt->rowset_after_end = 1;
+  stmt->rowset_reseek    = 0;
+
+  return SQL_NO_DATA;
+}
+
+static SQLRETURN _stmt_fetch_at(stmt_t *stmt, SQLLEN start, int before_start)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  // NOTE: start is 1-based, as in ODBC
+  sr = stmt->base->seek_row(stmt->base, (size_t)(start - 1));
+  if (sr == SQL_NO_DATA) return _stmt_fetch_after_end(stmt);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  size_t row_array_size = _stmt_get_row_array_size(stmt);
+  if (row_array_size == 0) row_array_size = 1;
+
+  stmt->rowset_after_end = 0;
+  stmt->rowset_reseek    = 0;
+
+  sr = _stmt_fetch_x(stmt);
+  if (sr == SQL_NO_DATA) return _stmt_fetch_after_end(stmt);
+  if (sr == SQL_ERROR) return SQL_ERROR;
+
+  stmt->rowset_start = start;
+  stmt->rowset_size  = row_array_size;
+
+  if (before_start) {
+    stmt_append_err(stmt, "01S06", 0, "Attempt to fetch before the result set returned the first rowset");
+    return SQL_SUCCESS_WITH_INFO;
+  }
+
+  return sr;
+}
+
+static SQLRETURN _stmt_fetch_scroll_last(stmt_t *stmt, SQLLEN *last)
+{
+  // NOTE: drains the whole result set into the cache, thus only when positioning relative to the end
+  size_t nr_rows = 0;
+  SQLRETURN sr = stmt->base->get_num_rows(stmt->base, &nr_rows);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  *last = (SQLLEN)nr_rows;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_fetch_scroll(stmt_t *stmt, SQLSMALLINT FetchOrientation, SQLLEN FetchOffset)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  if (stmt->cursor_type != SQL_CURSOR_STATIC || !stmt->base || !stmt->base->seek_row || !stmt->base->get_num_rows) {
+    stmt_append_err_format(stmt, "HY106", 0,
+        "Fetch type out of range:[%s] requires a static cursor",
+        sql_fetch_orientation(FetchOrientation));
+    return SQL_ERROR;
+  }
+
+  // NOTE: https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlfetchscroll-function#cursor-positioning-rules
+  //       rows past the end are detected by _stmt_fetch_at, thus last is only resolved when counting from the end
+  SQLLEN last = 0;
+  SQLLEN size = (SQLLEN)_stmt_get_row_array_size(stmt);
+  if (size == 0) size = 1;
+
+  SQLLEN start       = stmt->rowset_start;
+  int    after_end   = stmt->rowset_after_end;
+  int    before      = !after_end && start == 0;
+
+  switch (FetchOrientation) {
+    case SQL_FETCH_FIRST:
+      return _stmt_fetch_at(stmt, 1, 0);
+    case SQL_FETCH_LAST:
+      sr = _stmt_fetch_scroll_last(stmt, &last);
+      if (sr != SQL_SUCCESS) return SQL_ERROR;
+      if (last == 0) return _stmt_fetch_after_end(stmt);
+      if (size > last) return _stmt_fetch_at(stmt, 1, 0);
+      return _stmt_fetch_at(stmt, last - size + 1, 0);
+    case SQL_FETCH_PRIOR:
+      if (before) return _stmt_fetch_before_start(stmt);
+      if (after_end) {
+        sr = _stmt_fetch_scroll_last(stmt, &last);
+        if (sr != SQL_SUCCESS) return SQL_ERROR;
+        if (last == 0) return _stmt_fetch_before_start(stmt);
+        if (last < size) return _stmt_fetch_at(stmt, 1, 1);
+        return _stmt_fetch_at(stmt, last - size + 1, 0);
+      }
+      if (start == 1) return _stmt_fetch_before_start(stmt);
+      if (start <= size) return _stmt_fetch_at(stmt, 1, 1);
+      return _stmt_fetch_at(stmt, start - size, 0);
+    case SQL_FETCH_RELATIVE:
+      if ((before && FetchOffset > 0) || (after_end && FetchOffset < 0)) break;
+      if (before) return _stmt_fetch_before_start(stmt);
+      if (after_end) return _stmt_fetch_after_end(stmt);
+      if (start + FetchOffset < 1) {
+        if (start == 1 || -FetchOffset > size) return _stmt_fetch_before_start(stmt);
+        return _stmt_fetch_at(stmt, 1, 1);
+      }
+      return _stmt_fetch_at(stmt, start + FetchOffset, 0);
+    case SQL_FETCH_ABSOLUTE:
+      break;
+    default:
+      stmt_append_err_format(stmt, "HY106", 0,
+          "Fetch type out of range:[%s] not supported",
+          sql_fetch_orientation(FetchOrientation));
+      return SQL_ERROR;
+  }
+
+  // NOTE: SQL_FETCH_ABSOLUTE, or SQL_FETCH_RELATIVE that is resolved as if SQL_FETCH_ABSOLUTE
+  if (FetchOffset < 0) {
+    sr = _stmt_fetch_scroll_last(stmt, &last);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+    if (-FetchOffset <= last) return _stmt_fetch_at(stmt, last + FetchOffset + 1, 0);
+    if (-FetchOffset > size) return _stmt_fetch_before_start(stmt);
+    if (last == 0) return _stmt_fetch_before_start(stmt);
+    return _stmt_fetch_at(stmt, 1, 1);
+  }
+  if (FetchOffset == 0) return _stmt_fetch_before_start(stmt);
+  return _stmt_fetch_at(stmt, FetchOffset, 0);
+}
+
+SQLRETURN stmt_fetch_scroll(stmt_t *stmt,
+    SQLSMALLINT   FetchOrientation,
+    SQLLEN        FetchOffset)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  _get_data_ctx_reset(&stmt->get_data_ctx);
+
+  _stmt_cancel_enter(stmt);
+  switch (FetchOrientation) {
+    case SQL_FETCH_NEXT:
+      (void)FetchOffset;
+      sr = _stmt_fetch(stmt);
+      break;
+    default:
+      sr = _stmt_fetch_scroll(stmt, FetchOrientation, FetchOffset);
+      break;
+  }
+  return _stmt_cancel_leave(stmt, sr);
+}
+
+SQLRETURN stmt_fetch(stmt_t *stmt)
+{
+  return stmt_fetch_scroll(stmt, SQL_FETCH_NEXT, 0);
+}
+
+static SQLRETURN _stmt_prepare(stmt_t *stmt)
+{
+  return stmt->base->prepare(stmt->base, &stmt->current_sql);
 }
 
 static SQLRETURN _stmt_get_num_params(
@@ -5705,32 +6580,117 @@ static SQLRETURN _stmt_param_get(stmt_t *stmt, param_state_t *param_state)
   return _stmt_param_get_sqlc(stmt, param_state);
 }
 
-static SQLRETURN _stmt_param_adjust_reuse_sqlc_sbigint(stmt_t *stmt, param_state_t *param_state)
+static SQLRETURN _stmt_param_conv_dummy(stmt_t *stmt, param_state_t *param_state)
 {
   (void)stmt;
+  (void)param_state;
+  return SQL_SUCCESS;
+}
 
+static int _stmt_param_zero_copy_prepare(param_state_t *param_state, int32_t *length, size_t max_len)
+{
+  // NOTE: one pass over the indicators of the batch, -1 if any row needs the row-by-row path
   desc_record_t        *APD_record        = param_state->APD_record;
-  TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
-  tsdb_bind->buffer_type = tsdb_field->type;
-  tsdb_bind->length = NULL;
-  tsdb_bind->buffer_length = sizeof(int64_t);
+  if (param_state->subtbl_rows) return -1;
+
+  const char *buffer = (const char*)APD_record->DESC_DATA_PTR;
+  if (!buffer) return -1;
+
+  const size_t      nr_batch_size = (size_t)param_state->nr_batch_size;
+  const size_t      offset        = param_state->i_batch_offset;
+  const SQLLEN      BufferLength  = APD_record->DESC_OCTET_LENGTH;
+  const SQLSMALLINT ValueType     = (SQLSMALLINT)APD_record->DESC_CONCISE_TYPE;
+  const SQLLEN     *len_arr       = APD_record->DESC_OCTET_LENGTH_PTR;
+  const SQLLEN     *ind_arr       = APD_record->DESC_INDICATOR_PTR;
+  char             *is_null       = tsdb_bind->is_null;
+
+  if (length && BufferLength <= 0) return -1;
+  if (len_arr) len_arr += offset;
+  if (ind_arr) ind_arr += offset;
+
+  for (size_t i = 0; i < nr_batch_size; ++i) {
+    if (ind_arr && ind_arr[i] == SQL_NULL_DATA) {
+      is_null[i] = 1;
+      if (length) length[i] = 0;
+      continue;
+    }
+    is_null[i] = 0;
+    if (!length) continue;
+
+    const char *base = buffer + BufferLength * (offset + i);
+    size_t len = 0;
+    if (!len_arr) {
+      len = (ValueType == SQL_C_CHAR) ? strnlen(base, BufferLength) : (size_t)BufferLength;
+    } else if (len_arr[i] == SQL_NTS && ValueType == SQL_C_CHAR) {
+      len = strnlen(base, BufferLength);
+    } else if (len_arr[i] < 0 || len_arr[i] > BufferLength) {
+      return -1;
+    } else {
+      len = (size_t)len_arr[i];
+    }
+    if (len > max_len) return -1;
+    length[i] = (int32_t)len;
+  }
+
+  return 0;
+}
+
+static SQLRETURN _stmt_param_reuse_sqlc_buffer(stmt_t *stmt, param_state_t *param_state)
+{
+  desc_record_t        *APD_record        = param_state->APD_record;
+  tsdb_param_column_t  *param_column      = param_state->param_column;
+  TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   char *buffer = (char*)APD_record->DESC_DATA_PTR;
-  if (buffer) {
-    buffer = buffer + tsdb_bind->buffer_length * param_state->i_batch_offset;
+  if (!buffer) {
+    tsdb_bind->buffer = NULL;
+    return SQL_SUCCESS;
+  }
+
+  const size_t width = (size_t)tsdb_bind->buffer_length;
+
+  if (!param_state->subtbl_rows) {
+    tsdb_bind->buffer = buffer + width * param_state->i_batch_offset;
+    param_bind_meta_t *meta = _params_bind_meta_get(&stmt->params_bind_meta, param_state->i_param);
+    if (meta && meta->check == _stmt_param_check_dummy && meta->conv == _stmt_param_conv_dummy) {
+      if (_stmt_param_zero_copy_prepare(param_state, NULL, 0) == 0) param_state->zero_copy = 1;
+    }
+    return SQL_SUCCESS;
+  }
+
+  // NOTE: rows of a subtbl-group are scattered across the paramset, gather them
+  const size_t nr_batch_size = (size_t)param_state->nr_batch_size;
+  int r = mem_keep(&param_column->mem, width * nr_batch_size);
+  if (r) {
+    stmt_oom(stmt);
+    return SQL_ERROR;
   }
-  tsdb_bind->buffer = buffer;
+
+  const param_subtbl_row_t *rows = param_state->subtbl_rows + param_state->i_batch_offset;
+  for (size_t i = 0; i < nr_batch_size; ++i) {
+    memcpy(param_column->mem.base + width * i, buffer + width * rows[i].i_row, width);
+  }
+  tsdb_bind->buffer = param_column->mem.base;
 
   return SQL_SUCCESS;
 }
 
-static SQLRETURN _stmt_param_adjust_reuse_sqlc_double(stmt_t *stmt, param_state_t *param_state)
+static SQLRETURN _stmt_param_adjust_reuse_sqlc_sbigint(stmt_t *stmt, param_state_t *param_state)
 {
-  (void)stmt;
+  TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
+  TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
-  desc_record_t        *APD_record        = param_state->APD_record;
+  tsdb_bind->buffer_type = tsdb_field->type;
+  tsdb_bind->length = NULL;
+  tsdb_bind->buffer_length = sizeof(int64_t);
+
+  return _stmt_param_reuse_sqlc_buffer(stmt, param_state);
+}
+
+static SQLRETURN _stmt_param_adjust_reuse_sqlc_double(stmt_t *stmt, param_state_t *param_state)
+{
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -5738,20 +6698,11 @@ static SQLRETURN _stmt_param_adjust_reuse_sqlc_double(stmt_t *stmt, param_state_
   tsdb_bind->length = NULL;
   tsdb_bind->buffer_length = sizeof(double);
 
-  char *buffer = (char*)APD_record->DESC_DATA_PTR;
-  if (buffer) {
-    buffer = buffer + tsdb_bind->buffer_length * param_state->i_batch_offset;
-  }
-  tsdb_bind->buffer = buffer;
-
-  return SQL_SUCCESS;
+  return _stmt_param_reuse_sqlc_buffer(stmt, param_state);
 }
 
 static SQLRETURN _stmt_param_adjust_reuse_sqlc_float(stmt_t *stmt, param_state_t *param_state)
 {
-  (void)stmt;
-
-  desc_record_t        *APD_record        = param_state->APD_record;
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -5759,20 +6710,11 @@ static SQLRETURN _stmt_param_adjust_reuse_sqlc_float(stmt_t *stmt, param_state_t
   tsdb_bind->length = NULL;
   tsdb_bind->buffer_length = sizeof(float);
 
-  char *buffer = (char*)APD_record->DESC_DATA_PTR;
-  if (buffer) {
-    buffer = buffer + tsdb_bind->buffer_length * param_state->i_batch_offset;
-  }
-  tsdb_bind->buffer = buffer;
-
-  return SQL_SUCCESS;
+  return _stmt_param_reuse_sqlc_buffer(stmt, param_state);
 }
 
 static SQLRETURN _stmt_param_adjust_reuse_sqlc_long(stmt_t *stmt, param_state_t *param_state)
 {
-  (void)stmt;
-
-  desc_record_t        *APD_record        = param_state->APD_record;
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -5780,20 +6722,11 @@ static SQLRETURN _stmt_param_adjust_reuse_sqlc_long(stmt_t *stmt, param_state_t
   tsdb_bind->length = NULL;
   tsdb_bind->buffer_length = sizeof(int32_t);
 
-  char *buffer = (char*)APD_record->DESC_DATA_PTR;
-  if (buffer) {
-    buffer = buffer + tsdb_bind->buffer_length * param_state->i_batch_offset;
-  }
-  tsdb_bind->buffer = buffer;
-
-  return SQL_SUCCESS;
+  return _stmt_param_reuse_sqlc_buffer(stmt, param_state);
 }
 
 static SQLRETURN _stmt_param_adjust_reuse_sqlc_short(stmt_t *stmt, param_state_t *param_state)
 {
-  (void)stmt;
-
-  desc_record_t        *APD_record        = param_state->APD_record;
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -5801,20 +6734,11 @@ static SQLRETURN _stmt_param_adjust_reuse_sqlc_short(stmt_t *stmt, param_state_t
   tsdb_bind->length = NULL;
   tsdb_bind->buffer_length = sizeof(int16_t);
 
-  char *buffer = (char*)APD_record->DESC_DATA_PTR;
-  if (buffer) {
-    buffer = buffer + tsdb_bind->buffer_length * param_state->i_batch_offset;
-  }
-  tsdb_bind->buffer = buffer;
-
-  return SQL_SUCCESS;
+  return _stmt_param_reuse_sqlc_buffer(stmt, param_state);
 }
 
 static SQLRETURN _stmt_param_adjust_reuse_sqlc_tinyint(stmt_t *stmt, param_state_t *param_state)
 {
-  (void)stmt;
-
-  desc_record_t        *APD_record        = param_state->APD_record;
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -5822,13 +6746,7 @@ static SQLRETURN _stmt_param_adjust_reuse_sqlc_tinyint(stmt_t *stmt, param_state
   tsdb_bind->length = NULL;
   tsdb_bind->buffer_length = sizeof(int8_t);
 
-  char *buffer = (char*)APD_record->DESC_DATA_PTR;
-  if (buffer) {
-    buffer = buffer + tsdb_bind->buffer_length * param_state->i_batch_offset;
-  }
-  tsdb_bind->buffer = buffer;
-
-  return SQL_SUCCESS;
+  return _stmt_param_reuse_sqlc_buffer(stmt, param_state);
 }
 
 static SQLRETURN _stmt_param_adjust_tsdb_tinyint(stmt_t *stmt, param_state_t *param_state)
@@ -6126,13 +7044,13 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_char_tsdb_varchar(stmt_t *stmt,
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   charset_conv_t *cnv  = param_state->charset_convs.cnv_from_sqlc_charset_for_param_bind_to_tsdb;
 
   char *tsdb_varchar = tsdb_bind->buffer;
-  tsdb_varchar += (i_row - param_state->i_batch_offset) * tsdb_bind->buffer_length;
+  tsdb_varchar += i_bind * tsdb_bind->buffer_length;
   size_t tsdb_varchar_len = tsdb_bind->buffer_length;
 
   size_t         inbytes             = len;
@@ -6157,7 +7075,7 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_char_tsdb_varchar(stmt_t *stmt,
   }
 
   if (tsdb_bind->length) {
-    tsdb_bind->length[i_row - param_state->i_batch_offset] = (int32_t)(outbytes - outbytesleft);
+    tsdb_bind->length[i_bind] = (int32_t)(outbytes - outbytesleft);
   }
 
   if (inbytesleft) {
@@ -6174,11 +7092,11 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_binary_tsdb_varbinary(stmt_t *s
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   unsigned char *tsdb_varbinary = tsdb_bind->buffer;
-  tsdb_varbinary += (i_row - param_state->i_batch_offset) * tsdb_bind->buffer_length;
+  tsdb_varbinary += i_bind * tsdb_bind->buffer_length;
   size_t tsdb_varbinary_len = tsdb_bind->buffer_length;
 
   size_t n = len;
@@ -6186,7 +7104,7 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_binary_tsdb_varbinary(stmt_t *s
   memcpy(tsdb_varbinary, s, n);
 
   if (tsdb_bind->length) {
-    tsdb_bind->length[i_row - param_state->i_batch_offset] = (int32_t)n;
+    tsdb_bind->length[i_bind] = (int32_t)n;
   }
 
   if (len > tsdb_varbinary_len) {
@@ -6203,11 +7121,11 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_binary_tsdb_geometry(stmt_t *st
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   unsigned char *tsdb_geometry = tsdb_bind->buffer;
-  tsdb_geometry += (i_row - param_state->i_batch_offset) * tsdb_bind->buffer_length;
+  tsdb_geometry += i_bind * tsdb_bind->buffer_length;
   size_t tsdb_geometry_len = tsdb_bind->buffer_length;
 
   size_t n = len;
@@ -6215,7 +7133,7 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_binary_tsdb_geometry(stmt_t *st
   memcpy(tsdb_geometry, s, n);
 
   if (tsdb_bind->length) {
-    tsdb_bind->length[i_row - param_state->i_batch_offset] = (int32_t)n;
+    tsdb_bind->length[i_bind] = (int32_t)n;
   }
 
   if (len > tsdb_geometry_len) {
@@ -6242,7 +7160,7 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_char_tsdb_timestamp(stmt_t *stm
 
 
   char *tsdb_timestamp = tsdb_bind->buffer;
-  tsdb_timestamp += (i_row - param_state->i_batch_offset) * tsdb_bind->buffer_length;
+  tsdb_timestamp += param_state->i_bind * tsdb_bind->buffer_length;
 
   int64_t v = 0;
   if (IPD_record->DESC_CONCISE_TYPE == SQL_TYPE_TIMESTAMP) {
@@ -6278,13 +7196,13 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_wchar_tsdb_varchar(stmt_t *stmt
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   charset_conv_t *cnv  = param_state->charset_convs.cnv_from_wchar_to_tsdb;
 
   char *tsdb_varchar = tsdb_bind->buffer;
-  tsdb_varchar += (i_row - param_state->i_batch_offset) * tsdb_bind->buffer_length;
+  tsdb_varchar += i_bind * tsdb_bind->buffer_length;
   size_t tsdb_varchar_len = tsdb_bind->buffer_length;
 
   size_t         inbytes             = wlen * 2;
@@ -6315,7 +7233,7 @@ static SQLRETURN _stmt_conv_param_data_from_sqlc_wchar_tsdb_varchar(stmt_t *stmt
   }
 
   if (tsdb_bind->length) {
-    tsdb_bind->length[i_row - param_state->i_batch_offset] = (int32_t)(outbytes - outbytesleft);
+    tsdb_bind->length[i_bind] = (int32_t)(outbytes - outbytesleft);
   }
 
   return SQL_SUCCESS;
@@ -6460,6 +7378,62 @@ static SQLRETURN _stmt_param_adjust_tsdb_geometry(stmt_t *stmt, param_state_t *p
   return SQL_SUCCESS;
 }
 
+static SQLRETURN _stmt_param_adjust_zero_copy(stmt_t *stmt, param_state_t *param_state)
+{
+  int nr_batch_size                       = param_state->nr_batch_size;
+  desc_record_t        *APD_record        = param_state->APD_record;
+  TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
+  tsdb_param_column_t  *param_column      = param_state->param_column;
+  TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
+
+  int r = 0;
+
+  r = mem_keep(&param_column->mem_length, sizeof(*tsdb_bind->length) * nr_batch_size);
+  if (r) {
+    stmt_oom(stmt);
+    return SQL_ERROR;
+  }
+
+  int32_t *length = (int32_t*)param_column->mem_length.base;
+  r = _stmt_param_zero_copy_prepare(param_state, length, tsdb_field->bytes - 2);
+  if (r) return SQL_NO_DATA;
+
+  tsdb_bind->length = length;
+  tsdb_bind->buffer_type = tsdb_field->type;
+  tsdb_bind->buffer_length = APD_record->DESC_OCTET_LENGTH;
+  tsdb_bind->buffer = (char*)APD_record->DESC_DATA_PTR + APD_record->DESC_OCTET_LENGTH * param_state->i_batch_offset;
+  param_state->zero_copy = 1;
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_varchar(stmt_t *stmt, param_state_t *param_state)
+{
+  charset_conv_t *cnv = param_state->charset_convs.cnv_from_sqlc_charset_for_param_bind_to_tsdb;
+  if (tod_strcasecmp(cnv->from, cnv->to) == 0) {
+    SQLRETURN sr = _stmt_param_adjust_zero_copy(stmt, param_state);
+    if (sr != SQL_NO_DATA) return sr;
+  }
+
+  return _stmt_param_adjust_tsdb_varchar(stmt, param_state);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_binary_tsdb_varbinary(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_zero_copy(stmt, param_state);
+  if (sr != SQL_NO_DATA) return sr;
+
+  return _stmt_param_adjust_tsdb_varbinary(stmt, param_state);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_binary_tsdb_geometry(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_zero_copy(stmt, param_state);
+  if (sr != SQL_NO_DATA) return sr;
+
+  return _stmt_param_adjust_tsdb_geometry(stmt, param_state);
+}
+
 static SQLRETURN _stmt_param_adjust_tsdb_nchar(stmt_t *stmt, param_state_t *param_state)
 {
   int nr_batch_size                       = param_state->nr_batch_size;
@@ -6500,13 +7474,6 @@ static SQLRETURN _stmt_param_adjust_tsdb_json(stmt_t *stmt, param_state_t *param
   return _stmt_param_adjust_tsdb_nchar(stmt, param_state);
 }
 
-static SQLRETURN _stmt_param_conv_dummy(stmt_t *stmt, param_state_t *param_state)
-{
-  (void)stmt;
-  (void)param_state;
-  return SQL_SUCCESS;
-}
-
 static SQLRETURN _stmt_param_conv_sql_integer_to_tsdb_int(stmt_t *stmt, param_state_t *param_state)
 {
   int                   i_row             = param_state->i_row;
@@ -6537,7 +7504,7 @@ static SQLRETURN _stmt_param_conv_sql_integer_to_tsdb_int(stmt_t *stmt, param_st
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int32_t *v = (int32_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int32_t)i64;
+  v[param_state->i_bind] = (int32_t)i64;
 
   return SQL_SUCCESS;
 }
@@ -6572,7 +7539,7 @@ static SQLRETURN _stmt_param_conv_sql_smallint_to_tsdb_smallint(stmt_t *stmt, pa
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int16_t *v = (int16_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int16_t)i64;
+  v[param_state->i_bind] = (int16_t)i64;
 
   return SQL_SUCCESS;
 }
@@ -6607,7 +7574,7 @@ static SQLRETURN _stmt_param_conv_sql_tinyint_to_tsdb_tinyint(stmt_t *stmt, para
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int8_t *v = (int8_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int8_t)i64;
+  v[param_state->i_bind] = (int8_t)i64;
 
   return SQL_SUCCESS;
 }
@@ -6642,14 +7609,14 @@ static SQLRETURN _stmt_param_conv_sql_tinyint_to_tsdb_bool(stmt_t *stmt, param_s
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int8_t *v = (int8_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int8_t)!!i64;
+  v[param_state->i_bind] = (int8_t)!!i64;
 
   return SQL_SUCCESS;
 }
 
 static SQLRETURN _stmt_param_conv_sql_timestamp_to_tsdb_timestamp(stmt_t *stmt, param_state_t *param_state)
 {
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   sql_data_t           *data              = &param_state->sql_data;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
@@ -6670,14 +7637,14 @@ static SQLRETURN _stmt_param_conv_sql_timestamp_to_tsdb_timestamp(stmt_t *stmt,
   }
 
   int64_t *tsdb_timestamp = (int64_t*)tsdb_bind->buffer;
-  tsdb_timestamp[i_row - param_state->i_batch_offset] = v;
+  tsdb_timestamp[i_bind] = v;
 
   return SQL_SUCCESS;
 }
 
 static SQLRETURN _stmt_param_conv_sql_double_to_tsdb_timestamp(stmt_t *stmt, param_state_t *param_state)
 {
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   sql_data_t           *data              = &param_state->sql_data;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
   TAOS_FIELD_E         *tsdb_field        = param_state->tsdb_field;
@@ -6694,7 +7661,7 @@ static SQLRETURN _stmt_param_conv_sql_double_to_tsdb_timestamp(stmt_t *stmt, par
   }
 
   int64_t *tsdb_timestamp = (int64_t*)tsdb_bind->buffer;
-  tsdb_timestamp[i_row - param_state->i_batch_offset] = v;
+  tsdb_timestamp[i_bind] = v;
 
   return SQL_SUCCESS;
 }
@@ -6703,7 +7670,7 @@ static SQLRETURN _stmt_param_conv_sql_double_to_tsdb_float(stmt_t *stmt, param_s
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   sql_data_t           *data              = &param_state->sql_data;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -6720,7 +7687,7 @@ static SQLRETURN _stmt_param_conv_sql_double_to_tsdb_float(stmt_t *stmt, param_s
   }
 
   float *v = (float*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (float)dbl;
+  v[i_bind] = (float)dbl;
 
   return SQL_SUCCESS;
 }
@@ -6729,7 +7696,7 @@ static SQLRETURN _stmt_param_conv_sql_double_to_tsdb_int(stmt_t *stmt, param_sta
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   sql_data_t           *data              = &param_state->sql_data;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
@@ -6756,7 +7723,7 @@ static SQLRETURN _stmt_param_conv_sql_double_to_tsdb_int(stmt_t *stmt, param_sta
   }
 
   int32_t *v = (int32_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int32_t)dbl;
+  v[i_bind] = (int32_t)dbl;
 
   return SQL_SUCCESS;
 }
@@ -6765,12 +7732,12 @@ static SQLRETURN _stmt_param_conv_sql_real_to_tsdb_float(stmt_t *stmt, param_sta
 {
   (void)stmt;
 
-  int                   i_row             = param_state->i_row;
+  int                   i_bind            = param_state->i_bind;
   sql_data_t           *data              = &param_state->sql_data;
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   float *v = (float*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = data->flt;
+  v[i_bind] = data->flt;
 
   return SQL_SUCCESS;
 }
@@ -6871,7 +7838,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_bool(stmt_t *stmt, param_sta
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int8_t *v = (int8_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int8_t)!!ll;
+  v[param_state->i_bind] = (int8_t)!!ll;
 
   return SQL_SUCCESS;
 }
@@ -6919,7 +7886,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_tinyint(stmt_t *stmt, param_
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int8_t *v = (int8_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int8_t)ll;
+  v[param_state->i_bind] = (int8_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -6967,7 +7934,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_utinyint(stmt_t *stmt, param
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   uint8_t *v = (uint8_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (uint8_t)ll;
+  v[param_state->i_bind] = (uint8_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -7015,7 +7982,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_smallint(stmt_t *stmt, param
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int16_t *v = (int16_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int16_t)ll;
+  v[param_state->i_bind] = (int16_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -7063,7 +8030,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_usmallint(stmt_t *stmt, para
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   uint16_t *v = (uint16_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (uint16_t)ll;
+  v[param_state->i_bind] = (uint16_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -7111,7 +8078,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_int(stmt_t *stmt, param_stat
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int32_t *v = (int32_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int32_t)ll;
+  v[param_state->i_bind] = (int32_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -7159,7 +8126,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_uint(stmt_t *stmt, param_sta
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   uint32_t *v = (uint32_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (uint32_t)ll;
+  v[param_state->i_bind] = (uint32_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -7197,7 +8164,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_bigint(stmt_t *stmt, param_s
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   int64_t *v = (int64_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (int64_t)ll;
+  v[param_state->i_bind] = (int64_t)ll;
 
   return SQL_SUCCESS;
 }
@@ -7235,7 +8202,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_ubigint(stmt_t *stmt, param_
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   uint64_t *v = (uint64_t*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = (uint64_t)ull;
+  v[param_state->i_bind] = (uint64_t)ull;
 
   return SQL_SUCCESS;
 }
@@ -7283,7 +8250,7 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_float(stmt_t *stmt, param_st
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   float *v = (float*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = flt;
+  v[param_state->i_bind] = flt;
 
   return SQL_SUCCESS;
 }
@@ -7331,44 +8298,347 @@ static SQLRETURN _stmt_param_conv_sqlc_char_to_tsdb_double(stmt_t *stmt, param_s
   TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
 
   double *v = (double*)tsdb_bind->buffer;
-  v[i_row - param_state->i_batch_offset] = dbl;
+  v[param_state->i_bind] = dbl;
 
   return SQL_SUCCESS;
 }
 
-static const param_bind_map_t _param_bind_map[] = {
-  {SQL_C_SBIGINT, SQL_VARCHAR, TSDB_DATA_TYPE_BIGINT,
-    _stmt_param_adjust_reuse_sqlc_sbigint,
-    _stmt_param_conv_dummy},
-  {SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, TSDB_DATA_TYPE_TIMESTAMP,
-    _stmt_param_adjust_reuse_sqlc_sbigint,
-    _stmt_param_conv_dummy},
-  {SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, TSDB_DATA_TYPE_BIGINT,
-    _stmt_param_adjust_reuse_sqlc_sbigint,
-    _stmt_param_conv_dummy},
-  {SQL_C_SBIGINT, SQL_BIGINT, TSDB_DATA_TYPE_TIMESTAMP,
-    _stmt_param_adjust_reuse_sqlc_sbigint,
-    _stmt_param_conv_dummy},
-  {SQL_C_SBIGINT, SQL_BIGINT, TSDB_DATA_TYPE_BIGINT,
-    _stmt_param_adjust_reuse_sqlc_sbigint,
-    _stmt_param_conv_dummy},
-  {SQL_C_SBIGINT, SQL_INTEGER, TSDB_DATA_TYPE_INT,
-    _stmt_param_adjust_tsdb_int,
-    _stmt_param_conv_sql_integer_to_tsdb_int},
-  {SQL_C_SBIGINT, SQL_SMALLINT, TSDB_DATA_TYPE_SMALLINT,
-    _stmt_param_adjust_tsdb_smallint,
-    _stmt_param_conv_sql_smallint_to_tsdb_smallint},
-  {SQL_C_SBIGINT, SQL_TINYINT, TSDB_DATA_TYPE_TINYINT,
-    _stmt_param_adjust_tsdb_tinyint,
-    _stmt_param_conv_sql_tinyint_to_tsdb_tinyint},
-  {SQL_C_SBIGINT, SQL_TINYINT, TSDB_DATA_TYPE_BOOL,
-    _stmt_param_adjust_tsdb_bool,
-    _stmt_param_conv_sql_tinyint_to_tsdb_bool},
+static int _stmt_param_sqlc_char_at(const desc_record_t *APD_record, size_t i_row, const char **s, size_t *n)
+{
+  const SQLLEN  BufferLength = APD_record->DESC_OCTET_LENGTH;
+  const SQLLEN *len_arr      = APD_record->DESC_OCTET_LENGTH_PTR;
+  const char   *base         = (const char*)APD_record->DESC_DATA_PTR + BufferLength * i_row;
 
-  {SQL_C_DOUBLE,  SQL_TYPE_TIMESTAMP, TSDB_DATA_TYPE_TIMESTAMP,
-    _stmt_param_adjust_tsdb_timestamp,
-    _stmt_param_conv_sql_timestamp_to_tsdb_timestamp},
-  {SQL_C_DOUBLE,  SQL_DOUBLE, TSDB_DATA_TYPE_TIMESTAMP,
+  size_t len = 0;
+  if (!len_arr || len_arr[i_row] == SQL_NTS) {
+    if (BufferLength <= 0) return -1;
+    len = strnlen(base, BufferLength);
+    if (len == (size_t)BufferLength) return -1;
+  } else if (len_arr[i_row] < 0 || len_arr[i_row] > INT32_MAX) {
+    return -1;
+  } else {
+    len = (size_t)len_arr[i_row];
+  }
+
+  *s = base;
+  *n = len;
+  return 0;
+}
+
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__    /* [ */
+static int _swar_is_8_digits(uint64_t x)
+{
+  return (((x & 0xF0F0F0F0F0F0F0F0ULL) | (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+}
+
+static uint64_t _swar_parse_8_digits(uint64_t x)
+{
+  const uint64_t mask = 0x000000FF000000FFULL;
+  const uint64_t mul1 = 100 + (1000000ULL << 32);
+  const uint64_t mul2 = 1 + (10000ULL << 32);
+  x -= 0x3030303030303030ULL;
+  x = (x * 10) + (x >> 8);
+  return (((x & mask) * mul1) + (((x >> 16) & mask) * mul2)) >> 32;
+}
+#endif                                                                         /* ] */
+
+static int _parse_dec_digits(const char *s, size_t n, uint64_t *v)
+{
+  // NOTE: n <= 19, thus no overflow
+  uint64_t u = 0;
+  size_t i = 0;
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__    /* [ */
+  for (; i + 8 <= n; i += 8) {
+    uint64_t x;
+    memcpy(&x, s + i, 8);
+    if (!_swar_is_8_digits(x)) return -1;
+    u = u * 100000000 + _swar_parse_8_digits(x);
+  }
+#endif                                                                         /* ] */
+  for (; i < n; ++i) {
+    unsigned d = (unsigned char)(s[i] - '0');
+    if (d > 9) return -1;
+    u = u * 10 + d;
+  }
+  *v = u;
+  return 0;
+}
+
+static int _parse_sqlc_char_int(const char *s, size_t n, int *neg, uint64_t *mag)
+{
+  // NOTE: plain decimal only, anything else (spaces, hex, octal, ...) is left to strtoll
+  *neg = 0;
+  if (n && (s[0] == '+' || s[0] == '-')) {
+    *neg = (s[0] == '-');
+    ++s;
+    --n;
+  }
+  if (n == 0 || n > 19) return -1;
+  if (n > 1 && s[0] == '0') return -1;
+  return _parse_dec_digits(s, n, mag);
+}
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0        /* [ */
+static int _parse_sqlc_char_real(const char *s, size_t n, int *neg, uint64_t *mantissa, size_t *nr_frac)
+{
+  // NOTE: [+-]digits[.digits] only, no exponent/inf/nan, at most 19 significant digits
+  *neg = 0;
+  if (n && (s[0] == '+' || s[0] == '-')) {
+    *neg = (s[0] == '-');
+    ++s;
+    --n;
+  }
+  const char *dot = memchr(s, '.', n);
+  size_t nr_int  = dot ? (size_t)(dot - s) : n;
+  size_t nr_dec  = dot ? n - nr_int - 1 : 0;
+  if (nr_int + nr_dec == 0 || nr_int + nr_dec > 19) return -1;
+
+  uint64_t i = 0, f = 0;
+  if (_parse_dec_digits(s, nr_int, &i)) return -1;
+  if (nr_dec && _parse_dec_digits(dot + 1, nr_dec, &f)) return -1;
+  for (size_t k = 0; k < nr_dec; ++k) i *= 10;
+
+  *mantissa = i + f;
+  *nr_frac  = nr_dec;
+  return 0;
+}
+#endif                                                       /* ] */
+
+static SQLRETURN _stmt_param_conv_sqlc_char_column_prepare(stmt_t *stmt, param_state_t *param_state)
+{
+  desc_record_t        *APD_record        = param_state->APD_record;
+  tsdb_param_column_t  *param_column      = param_state->param_column;
+
+  if (!APD_record->DESC_DATA_PTR) return SQL_NO_DATA;
+
+  int r = mem_keep(&param_column->mem_done, (size_t)param_state->nr_batch_size);
+  if (r) {
+    stmt_oom(stmt);
+    return SQL_ERROR;
+  }
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_param_conv_sqlc_char_column_int(stmt_t *stmt, param_state_t *param_state, uint64_t neg_max, uint64_t pos_max)
+{
+  // NOTE: converts the whole column of the batch at once, rows left undone go through the row-by-row path
+  desc_record_t        *APD_record        = param_state->APD_record;
+  tsdb_param_column_t  *param_column      = param_state->param_column;
+  TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
+
+  SQLRETURN sr = _stmt_param_conv_sqlc_char_column_prepare(stmt, param_state);
+  if (sr == SQL_NO_DATA) return SQL_SUCCESS;
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  const SQLLEN  *ind_arr       = APD_record->DESC_INDICATOR_PTR;
+  const size_t   nr_batch_size = (size_t)param_state->nr_batch_size;
+  char          *done          = (char*)param_column->mem_done.base;
+  char          *buffer        = (char*)tsdb_bind->buffer;
+  const size_t   width         = (size_t)tsdb_bind->buffer_length;
+
+  for (size_t i = 0; i < nr_batch_size; ++i) {
+    size_t i_row = _param_state_row(param_state, i);
+    done[i] = 0;
+    if (ind_arr && ind_arr[i_row] == SQL_NULL_DATA) {
+      tsdb_bind->is_null[i] = 1;
+      done[i] = 1;
+      continue;
+    }
+
+    const char *str = NULL;
+    size_t len = 0;
+    int neg = 0;
+    uint64_t mag = 0;
+    if (_stmt_param_sqlc_char_at(APD_record, i_row, &str, &len)) continue;
+    if (_parse_sqlc_char_int(str, len, &neg, &mag)) continue;
+    if (mag > (neg ? neg_max : pos_max)) continue;
+
+    uint64_t u = neg ? (uint64_t)0 - mag : mag;
+    switch (width) {
+      case 1: { uint8_t  v = (uint8_t)u;  memcpy(buffer + i, &v, 1); } break;
+      case 2: { uint16_t v = (uint16_t)u; memcpy(buffer + i * 2, &v, 2); } break;
+      case 4: { uint32_t v = (uint32_t)u; memcpy(buffer + i * 4, &v, 4); } break;
+      case 8: memcpy(buffer + i * 8, &u, 8); break;
+      default: continue;
+    }
+    tsdb_bind->is_null[i] = 0;
+    done[i] = 1;
+  }
+
+  param_state->col_done = 1;
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_param_conv_sqlc_char_column_real(stmt_t *stmt, param_state_t *param_state)
+{
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD != 0        /* [ */
+  // NOTE: intermediates in extended precision would round twice, thus left to the row-by-row conversion
+  (void)stmt;
+  (void)param_state;
+  return SQL_SUCCESS;
+#else                                                        /* ][ */
+  // NOTE: only values exactly representable before one correctly-rounded division are converted here,
+  //       which yields the same bits as strtod/strtof
+  static const double _pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+  };
+  static const float _pow10f[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+  };
+
+  desc_record_t        *APD_record        = param_state->APD_record;
+  tsdb_param_column_t  *param_column      = param_state->param_column;
+  TAOS_MULTI_BIND      *tsdb_bind         = param_state->tsdb_bind;
+
+  SQLRETURN sr = _stmt_param_conv_sqlc_char_column_prepare(stmt, param_state);
+  if (sr == SQL_NO_DATA) return SQL_SUCCESS;
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  const SQLLEN  *ind_arr       = APD_record->DESC_INDICATOR_PTR;
+  const size_t   nr_batch_size = (size_t)param_state->nr_batch_size;
+  char          *done          = (char*)param_column->mem_done.base;
+  const int      is_float      = (tsdb_bind->buffer_length == sizeof(float));
+
+  for (size_t i = 0; i < nr_batch_size; ++i) {
+    size_t i_row = _param_state_row(param_state, i);
+    done[i] = 0;
+    if (ind_arr && ind_arr[i_row] == SQL_NULL_DATA) {
+      tsdb_bind->is_null[i] = 1;
+      done[i] = 1;
+      continue;
+    }
+
+    const char *str = NULL;
+    size_t len = 0;
+    int neg = 0;
+    uint64_t mantissa = 0;
+    size_t nr_frac = 0;
+    if (_stmt_param_sqlc_char_at(APD_record, i_row, &str, &len)) continue;
+    if (_parse_sqlc_char_real(str, len, &neg, &mantissa, &nr_frac)) continue;
+
+    if (is_float) {
+      if (mantissa > (1ULL << 24) || nr_frac >= sizeof(_pow10f) / sizeof(_pow10f[0])) continue;
+      float v = (float)mantissa / _pow10f[nr_frac];
+      ((float*)tsdb_bind->buffer)[i] = neg ? -v : v;
+    } else {
+      if (mantissa > (1ULL << 53) || nr_frac >= sizeof(_pow10) / sizeof(_pow10[0])) continue;
+      double v = (double)mantissa / _pow10[nr_frac];
+      ((double*)tsdb_bind->buffer)[i] = neg ? -v : v;
+    }
+    tsdb_bind->is_null[i] = 0;
+    done[i] = 1;
+  }
+
+  param_state->col_done = 1;
+  return SQL_SUCCESS;
+#endif                                                       /* ] */
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_tinyint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_tinyint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, (uint64_t)INT8_MAX + 1, INT8_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_utinyint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_utinyint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, 0, UINT8_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_smallint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_smallint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, (uint64_t)INT16_MAX + 1, INT16_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_usmallint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_usmallint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, 0, UINT16_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_int(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_int(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, (uint64_t)INT32_MAX + 1, INT32_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_uint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_uint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, 0, UINT32_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_bigint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_bigint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, (uint64_t)INT64_MAX + 1, INT64_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_ubigint(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_ubigint(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_int(stmt, param_state, 0, UINT64_MAX);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_float(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_float(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_real(stmt, param_state);
+}
+
+static SQLRETURN _stmt_param_adjust_sqlc_char_tsdb_double(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = _stmt_param_adjust_tsdb_double(stmt, param_state);
+  if (sr != SQL_SUCCESS) return sr;
+  return _stmt_param_conv_sqlc_char_column_real(stmt, param_state);
+}
+
+static const param_bind_map_t _param_bind_map[] = {
+  {SQL_C_SBIGINT, SQL_VARCHAR, TSDB_DATA_TYPE_BIGINT,
+    _stmt_param_adjust_reuse_sqlc_sbigint,
+    _stmt_param_conv_dummy},
+  {SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, TSDB_DATA_TYPE_TIMESTAMP,
+    _stmt_param_adjust_reuse_sqlc_sbigint,
+    _stmt_param_conv_dummy},
+  {SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, TSDB_DATA_TYPE_BIGINT,
+    _stmt_param_adjust_reuse_sqlc_sbigint,
+    _stmt_param_conv_dummy},
+  {SQL_C_SBIGINT, SQL_BIGINT, TSDB_DATA_TYPE_TIMESTAMP,
+    _stmt_param_adjust_reuse_sqlc_sbigint,
+    _stmt_param_conv_dummy},
+  {SQL_C_SBIGINT, SQL_BIGINT, TSDB_DATA_TYPE_BIGINT,
+    _stmt_param_adjust_reuse_sqlc_sbigint,
+    _stmt_param_conv_dummy},
+  {SQL_C_SBIGINT, SQL_INTEGER, TSDB_DATA_TYPE_INT,
+    _stmt_param_adjust_tsdb_int,
+    _stmt_param_conv_sql_integer_to_tsdb_int},
+  {SQL_C_SBIGINT, SQL_SMALLINT, TSDB_DATA_TYPE_SMALLINT,
+    _stmt_param_adjust_tsdb_smallint,
+    _stmt_param_conv_sql_smallint_to_tsdb_smallint},
+  {SQL_C_SBIGINT, SQL_TINYINT, TSDB_DATA_TYPE_TINYINT,
+    _stmt_param_adjust_tsdb_tinyint,
+    _stmt_param_conv_sql_tinyint_to_tsdb_tinyint},
+  {SQL_C_SBIGINT, SQL_TINYINT, TSDB_DATA_TYPE_BOOL,
+    _stmt_param_adjust_tsdb_bool,
+    _stmt_param_conv_sql_tinyint_to_tsdb_bool},
+
+  {SQL_C_DOUBLE,  SQL_TYPE_TIMESTAMP, TSDB_DATA_TYPE_TIMESTAMP,
+    _stmt_param_adjust_tsdb_timestamp,
+    _stmt_param_conv_sql_timestamp_to_tsdb_timestamp},
+  {SQL_C_DOUBLE,  SQL_DOUBLE, TSDB_DATA_TYPE_TIMESTAMP,
     _stmt_param_adjust_reuse_sqlc_double,
     _stmt_param_conv_sql_double_to_tsdb_timestamp},
   {SQL_C_DOUBLE,  SQL_DOUBLE, TSDB_DATA_TYPE_DOUBLE,
@@ -7401,10 +8671,10 @@ static const param_bind_map_t _param_bind_map[] = {
     _stmt_param_adjust_tsdb_timestamp,
     _stmt_param_conv_sqlc_char_to_tsdb_timestamp},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_VARCHAR,
-    _stmt_param_adjust_tsdb_varchar,
+    _stmt_param_adjust_sqlc_char_tsdb_varchar,
     _stmt_param_conv_sqlc_char_to_tsdb_varchar},
   {SQL_C_CHAR, SQL_WVARCHAR, TSDB_DATA_TYPE_VARCHAR,
-    _stmt_param_adjust_tsdb_varchar,
+    _stmt_param_adjust_sqlc_char_tsdb_varchar,
     _stmt_param_conv_sqlc_char_to_tsdb_varchar},
   {SQL_C_CHAR, SQL_WVARCHAR, TSDB_DATA_TYPE_NCHAR,
     _stmt_param_adjust_tsdb_nchar,
@@ -7422,34 +8692,34 @@ static const param_bind_map_t _param_bind_map[] = {
     _stmt_param_adjust_tsdb_bool,
     _stmt_param_conv_sqlc_char_to_tsdb_bool},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_TINYINT,
-    _stmt_param_adjust_tsdb_tinyint,
+    _stmt_param_adjust_sqlc_char_tsdb_tinyint,
     _stmt_param_conv_sqlc_char_to_tsdb_tinyint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_UTINYINT,
-    _stmt_param_adjust_tsdb_utinyint,
+    _stmt_param_adjust_sqlc_char_tsdb_utinyint,
     _stmt_param_conv_sqlc_char_to_tsdb_utinyint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_SMALLINT,
-    _stmt_param_adjust_tsdb_smallint,
+    _stmt_param_adjust_sqlc_char_tsdb_smallint,
     _stmt_param_conv_sqlc_char_to_tsdb_smallint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_USMALLINT,
-    _stmt_param_adjust_tsdb_usmallint,
+    _stmt_param_adjust_sqlc_char_tsdb_usmallint,
     _stmt_param_conv_sqlc_char_to_tsdb_usmallint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_INT,
-    _stmt_param_adjust_tsdb_int,
+    _stmt_param_adjust_sqlc_char_tsdb_int,
     _stmt_param_conv_sqlc_char_to_tsdb_int},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_UINT,
-    _stmt_param_adjust_tsdb_uint,
+    _stmt_param_adjust_sqlc_char_tsdb_uint,
     _stmt_param_conv_sqlc_char_to_tsdb_uint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_BIGINT,
-    _stmt_param_adjust_tsdb_bigint,
+    _stmt_param_adjust_sqlc_char_tsdb_bigint,
     _stmt_param_conv_sqlc_char_to_tsdb_bigint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_UBIGINT,
-    _stmt_param_adjust_tsdb_ubigint,
+    _stmt_param_adjust_sqlc_char_tsdb_ubigint,
     _stmt_param_conv_sqlc_char_to_tsdb_ubigint},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_FLOAT,
-    _stmt_param_adjust_tsdb_float,
+    _stmt_param_adjust_sqlc_char_tsdb_float,
     _stmt_param_conv_sqlc_char_to_tsdb_float},
   {SQL_C_CHAR, SQL_VARCHAR, TSDB_DATA_TYPE_DOUBLE,
-    _stmt_param_adjust_tsdb_double,
+    _stmt_param_adjust_sqlc_char_tsdb_double,
     _stmt_param_conv_sqlc_char_to_tsdb_double},
 
   {SQL_C_WCHAR, SQL_WVARCHAR, TSDB_DATA_TYPE_VARCHAR,
@@ -7492,11 +8762,11 @@ static const param_bind_map_t _param_bind_map[] = {
     _stmt_param_conv_dummy},
 
   {SQL_C_BINARY, SQL_VARBINARY, TSDB_DATA_TYPE_VARBINARY,
-    _stmt_param_adjust_tsdb_varbinary,
+    _stmt_param_adjust_sqlc_binary_tsdb_varbinary,
     _stmt_param_conv_sqlc_binary_to_tsdb_varbinary},
 
   {SQL_C_BINARY, SQL_VARBINARY, TSDB_DATA_TYPE_GEOMETRY,
-    _stmt_param_adjust_tsdb_geometry,
+    _stmt_param_adjust_sqlc_binary_tsdb_geometry,
     _stmt_param_conv_sqlc_binary_to_tsdb_geometry},
 };
 
@@ -7602,12 +8872,12 @@ static SQLRETURN _stmt_conv_param_data(stmt_t *stmt, param_state_t *param_state)
           i_row + 1, i_param + 1, sqlc_data_type(APD_record->DESC_CONCISE_TYPE));
       return SQL_ERROR;
     }
-    tsdb_bind->is_null[i_row - param_state->i_batch_offset] = 1;
+    tsdb_bind->is_null[param_state->i_bind] = 1;
     return SQL_SUCCESS;
   }
 
   if (tsdb_bind->is_null) {
-    tsdb_bind->is_null[i_row - param_state->i_batch_offset] = 0;
+    tsdb_bind->is_null[param_state->i_bind] = 0;
   }
 
   return _stmt_param_conv(stmt, param_state);
@@ -7634,6 +8904,12 @@ static SQLRETURN _stmt_execute_rebind_subtbl(stmt_t *stmt, const char *subtbl, s
 {
   tsdb_params_t *tsdb_params = &stmt->tsdb_stmt.params;
 
+  if (tsdb_params->memo_valid && tsdb_params->subtbl) {
+    if (strlen(tsdb_params->subtbl) == subtbl_len && memcmp(tsdb_params->subtbl, subtbl, subtbl_len) == 0) return SQL_SUCCESS;
+  }
+  tsdb_params->memo_valid = 0;
+  mem_reset(&tsdb_params->tags_memo);
+
   TOD_SAFE_FREE(tsdb_params->subtbl);
   tsdb_params->subtbl = strndup(subtbl, subtbl_len);
   if (!tsdb_params->subtbl) {
@@ -7706,21 +8982,12 @@ static SQLRETURN _stmt_init_param_state_cnvs(stmt_t *stmt, param_state_t *param_
   return SQL_SUCCESS;
 }
 
-static SQLRETURN _stmt_prepare_col_subtbl(stmt_t *stmt, param_state_t *param_state)
+static SQLRETURN _stmt_subtbl_conv(stmt_t *stmt, param_state_t *param_state, charset_conv_t **cnv)
 {
-  SQLRETURN sr = SQL_SUCCESS;
-
-  char buf_subtbl[192 * 6]; // FIXME: hard-coded
   const char *fromcode = NULL;
   const char *tocode   = conn_get_sqlc_charset(stmt->conn);
-  charset_conv_t *cnv = NULL;
-
-  const char *subtbl = NULL;
-  size_t subtbl_len  = 0;
-
-  desc_record_t *APD_record = param_state->APD_record;
 
-  SQLSMALLINT ValueType = (SQLSMALLINT)APD_record->DESC_CONCISE_TYPE;
+  SQLSMALLINT ValueType = (SQLSMALLINT)param_state->APD_record->DESC_CONCISE_TYPE;
   switch (ValueType) {
     case SQL_C_WCHAR:
       fromcode = "UTF-16LE";
@@ -7733,68 +9000,236 @@ static SQLRETURN _stmt_prepare_col_subtbl(stmt_t *stmt, param_state_t *param_sta
       return SQL_ERROR;
   }
 
-  cnv  = tls_get_charset_conv(fromcode, tocode);
-  if (!cnv) {
+  *cnv  = tls_get_charset_conv(fromcode, tocode);
+  if (!*cnv) {
     stmt_append_err_format(stmt, "HY000", 0, "General error:conversion for `%s` to `%s` not found or out of memory", fromcode, tocode);
     return SQL_ERROR;
   }
 
-  for (size_t i_row_offset = 0; i_row_offset < (size_t)param_state->nr_batch_size; ++i_row_offset) {
-    size_t i_row = param_state->i_batch_offset + i_row_offset;
-    param_state->i_row      = (int)i_row;
+  return SQL_SUCCESS;
+}
 
-    sr = _stmt_param_get(stmt, param_state);
-    if (sr != SQL_SUCCESS) return SQL_ERROR;
+static SQLRETURN _stmt_param_get_subtbl(stmt_t *stmt, param_state_t *param_state, charset_conv_t *cnv, char *buf, size_t cap, size_t *len)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  sr = _stmt_param_get(stmt, param_state);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  if (param_state->sqlc_data.is_null) {
+    stmt_append_err(stmt, "HY000", 0, "General error:subtbl is required, but got ==null==");
+    return SQL_ERROR;
+  }
+
+  sr = _stmt_param_check(stmt, param_state);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  size_t           inbytes = 0;
+  char            *inbuf   = NULL;
 
-    if (param_state->sqlc_data.is_null) {
-      stmt_append_err(stmt, "HY000", 0, "General error:subtbl is required, but got ==null==");
+  if (param_state->sqlc_data.type == SQL_C_WCHAR) {
+    inbuf               = (char*)param_state->sqlc_data.wstr.wstr;
+    inbytes             = param_state->sqlc_data.wstr.wlen * 2;
+  } else {
+    inbuf               = (char*)param_state->sqlc_data.str.str;
+    inbytes             = param_state->sqlc_data.str.len;
+  }
+
+  size_t           inbytesleft         = inbytes;
+  char            *outbuf              = buf;
+  size_t           outbytesleft        = cap - 1;
+
+  size_t n = CALL_iconv(cnv->cnv, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+  int e = errno;
+  iconv(cnv->cnv, NULL, NULL, NULL, NULL);
+  if (n == (size_t)-1) {
+    OA_NIY(0);
+    if (e != E2BIG) {
+      stmt_append_err_format(stmt, "HY000", 0,
+          "General error:[iconv]Character set conversion for `%s` to `%s` failed:[%d]%s",
+          cnv->from, cnv->to, e, strerror(e));
       return SQL_ERROR;
     }
+  }
 
-    sr = _stmt_param_check(stmt, param_state);
-    if (sr != SQL_SUCCESS) return SQL_ERROR;
+  // FIXME: check outbytesleft;
+  *outbuf = '\0';
+  *len = cap - 1 - outbytesleft;
 
-    char buf[sizeof(buf_subtbl)];
-    const char *base = NULL;
-    size_t len = 0;
+  return SQL_SUCCESS;
+}
 
-    size_t           inbytes = 0;
-    char            *inbuf   = NULL;
+static size_t _param_subtbl_hash(const char *name, size_t len)
+{
+  // NOTE: FNV-1a
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= (unsigned char)name[i];
+    h *= 16777619u;
+  }
+  return h;
+}
 
-    if (ValueType == SQL_C_WCHAR) {
-      inbuf               = (char*)param_state->sqlc_data.wstr.wstr;
-      inbytes             = param_state->sqlc_data.wstr.wlen * 2;
-    } else {
-      inbuf               = (char*)param_state->sqlc_data.str.str;
-      inbytes             = param_state->sqlc_data.str.len;
+static SQLRETURN _stmt_plan_subtbl(stmt_t *stmt, param_state_t *param_state, size_t nr_paramset_size)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+  int r = 0;
+
+  char buf[192 * 6]; // FIXME: hard-coded
+  charset_conv_t *cnv = NULL;
+
+  descriptor_t *APD = stmt_APD(stmt);
+  descriptor_t *IPD = stmt_IPD(stmt);
+  SQLUSMALLINT *param_status_ptr = IPD->header.DESC_ARRAY_STATUS_PTR;
+
+  param_state->subtbl_rows        = NULL;
+  param_state->nr_subtbl_rows     = 0;
+  param_state->nr_subtbl_rejected = 0;
+  param_state->i_param            = 0;
+  param_state->APD_record         = APD->records + 0;
+  param_state->IPD_record         = IPD->records + 0;
+
+  sr = _stmt_subtbl_conv(stmt, param_state, &cnv);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  mem_t *plan   = &param_state->subtbl_plan;
+  mem_t *names  = &param_state->subtbl_names;
+  mem_t *groups = &param_state->subtbl_groups;
+
+  // NOTE: open addressing, at most half full
+  size_t nr_slots = 16;
+  while (nr_slots < nr_paramset_size * 2) nr_slots <<= 1;
+
+  r = mem_keep(plan, sizeof(param_subtbl_row_t) * nr_paramset_size);
+  if (!r) r = mem_keep(groups, sizeof(param_subtbl_group_t) * nr_paramset_size + sizeof(size_t) * (nr_slots + nr_paramset_size));
+  if (r) {
+    stmt_oom(stmt);
+    return SQL_ERROR;
+  }
+  names->nr = 0;
+
+  param_subtbl_row_t   *rows      = (param_subtbl_row_t*)plan->base;
+  param_subtbl_group_t *grps      = (param_subtbl_group_t*)groups->base;
+  size_t               *slots     = (size_t*)(grps + nr_paramset_size);   // NOTE: 1-based group index, 0 if vacant
+  size_t               *group_of  = slots + nr_slots;
+  size_t                nr_grps   = 0;
+  size_t                nr_bad    = 0;
+
+  memset(slots, 0, sizeof(*slots) * nr_slots);
+
+  // NOTE: one pass, groups numbered by first appearance, thus executed in the order the application sent them
+  for (size_t i_row = 0; i_row < nr_paramset_size; ++i_row) {
+    size_t len = 0;
+    param_state->i_row = (int)i_row;
+    sr = _stmt_param_get_subtbl(stmt, param_state, cnv, buf, sizeof(buf), &len);
+    if (sr != SQL_SUCCESS) {
+      // NOTE: only this row is rejected, diagnostics kept, the rest are still planned
+      if (param_status_ptr) param_status_ptr[i_row] = SQL_PARAM_ERROR;
+      group_of[i_row] = (size_t)-1;
+      ++nr_bad;
+      continue;
     }
 
-    size_t           inbytesleft         = inbytes;
-    char            *outbuf              = buf;
-    const size_t     outbytes            = sizeof(buf);
-    size_t           outbytesleft        = sizeof(buf);
+    size_t h = _param_subtbl_hash(buf, len) & (nr_slots - 1);
+    while (slots[h]) {
+      const param_subtbl_group_t *g = grps + slots[h] - 1;
+      if (g->name_len == len && memcmp(names->base + g->name_offset, buf, len) == 0) break;
+      h = (h + 1) & (nr_slots - 1);
+    }
 
-    size_t n = CALL_iconv(cnv->cnv, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
-    int e = errno;
-    iconv(cnv->cnv, NULL, NULL, NULL, NULL);
-    if (n == (size_t)-1) {
-      OA_NIY(0);
-      if (e != E2BIG) {
-        stmt_append_err_format(stmt, "HY000", 0,
-            "General error:[iconv]Character set conversion for `%s` to `%s` failed:[%d]%s",
-            cnv->from, cnv->to, e, strerror(e));
-        return SQL_ERROR;
+    if (!slots[h]) {
+      if (names->nr + len + 1 > names->cap) {
+        r = mem_keep(names, (names->nr + len + 1 + names->cap + 1023) / 1024 * 1024);
+        if (r) {
+          stmt_oom(stmt);
+          return SQL_ERROR;
+        }
       }
+      memcpy(names->base + names->nr, buf, len + 1);
+
+      // NOTE: names might still move, thus offsets rather than pointers
+      param_subtbl_group_t *g = grps + nr_grps;
+      g->name_offset = names->nr;
+      g->name_len    = len;
+      g->nr_rows     = 0;
+      names->nr += len + 1;
+      slots[h] = ++nr_grps;
     }
 
-    // FIXME: check outbytesleft;
-    *outbuf = '\0';
-    base = buf;
-    len  = outbytes - outbytesleft;
+    grps[slots[h] - 1].nr_rows += 1;
+    group_of[i_row] = slots[h] - 1;
+  }
+
+  if (nr_bad == nr_paramset_size) return SQL_ERROR;
+
+  size_t i_next = 0;
+  for (size_t i_grp = 0; i_grp < nr_grps; ++i_grp) {
+    grps[i_grp].i_next = i_next;
+    i_next += grps[i_grp].nr_rows;
+  }
+
+  // NOTE: rows stay in paramset-order within a subtbl
+  for (size_t i_row = 0; i_row < nr_paramset_size; ++i_row) {
+    if (group_of[i_row] == (size_t)-1) continue;
+    param_subtbl_group_t *g = grps + group_of[i_row];
+    param_subtbl_row_t *row = rows + g->i_next++;
+    row->name     = (const char*)names->base + g->name_offset;
+    row->name_len = g->name_len;
+    row->i_row    = i_row;
+  }
+
+  param_state->subtbl_rows        = rows;
+  param_state->nr_subtbl_rows     = nr_paramset_size - nr_bad;
+  param_state->nr_subtbl_rejected = nr_bad;
+
+  return SQL_SUCCESS;
+}
+
+static size_t _param_state_subtbl_group_size(const param_state_t *param_state, size_t i_batch_offset, size_t nr)
+{
+  const param_subtbl_row_t *rows = param_state->subtbl_rows + i_batch_offset;
+  size_t i = 1;
+  for (; i < nr; ++i) {
+    if (rows[i].name_len != rows[0].name_len) break;
+    if (memcmp(rows[i].name, rows[0].name, rows[0].name_len)) break;
+  }
+  return i;
+}
+
+static SQLRETURN _stmt_prepare_col_subtbl(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  if (param_state->subtbl_rows) {
+    // NOTE: previous batch might still be executing, rebound right before binding, see _stmt_execute_pipelined_wait
+    if (param_state->pipelined && param_state->i_batch_offset) return SQL_SUCCESS;
+    // NOTE: bound to the shard statement instead, see _stmt_execute_shard_batch
+    if (param_state->sharded && param_state->i_batch_offset) return SQL_SUCCESS;
+    const param_subtbl_row_t *row = param_state->subtbl_rows + param_state->i_batch_offset;
+    return _stmt_execute_rebind_subtbl(stmt, row->name, row->name_len);
+  }
+
+  char buf_subtbl[192 * 6]; // FIXME: hard-coded
+  charset_conv_t *cnv = NULL;
+
+  const char *subtbl = NULL;
+  size_t subtbl_len  = 0;
+
+  sr = _stmt_subtbl_conv(stmt, param_state, &cnv);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  for (size_t i_row_offset = 0; i_row_offset < (size_t)param_state->nr_batch_size; ++i_row_offset) {
+    size_t i_row = param_state->i_batch_offset + i_row_offset;
+    param_state->i_row      = (int)i_row;
+
+    char buf[sizeof(buf_subtbl)];
+    size_t len = 0;
+
+    sr = _stmt_param_get_subtbl(stmt, param_state, cnv, buf, sizeof(buf), &len);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
 
     if (subtbl == NULL) {
-      strncpy(buf_subtbl, base, len);
-      buf_subtbl[len] = '\0';
+      memcpy(buf_subtbl, buf, len + 1);
       subtbl      = buf_subtbl;
       subtbl_len  = len;
 
@@ -7804,9 +9239,9 @@ static SQLRETURN _stmt_prepare_col_subtbl(stmt_t *stmt, param_state_t *param_sta
       continue;
     }
 
-    if (subtbl_len == len && strncmp(subtbl, base, len) == 0) continue;
+    if (subtbl_len == len && strncmp(subtbl, buf, len) == 0) continue;
 
-    param_state->nr_batch_size    = (int)(i_row - param_state->i_batch_offset);
+    param_state->nr_batch_size    = (int)i_row_offset;
     return SQL_SUCCESS;
   }
 
@@ -7848,6 +9283,8 @@ static SQLRETURN _stmt_prepare_col(stmt_t *stmt, param_state_t *param_state)
 
   param_state->param_column = stmt->tsdb_paramset.params + param_state->i_param;
   param_state->tsdb_bind = stmt->tsdb_binds.mbs + param_state->i_param;
+  param_state->zero_copy = 0;
+  param_state->col_done  = 0;
 
   sr = _stmt_param_tsdb_array_adjust(stmt, param_state);
   if (sr != SQL_SUCCESS) return SQL_ERROR;
@@ -7873,11 +9310,34 @@ static void _stmt_prepare_col_data(stmt_t *stmt, param_state_t *param_state)
 
   param_state->tsdb_bind = stmt->tsdb_binds.mbs + param_state->i_param;
 
+  unsigned char *row_skips = param_state->continue_on_error ? param_state->row_skips.base : NULL;
+
+  if (param_state->zero_copy) {
+    // NOTE: bound in place by the adjuster, nothing to check or convert row by row
+    if (param_status_ptr) {
+      for (size_t i = 0; i < (size_t)param_state->nr_batch_size; ++i) {
+        if (row_skips && row_skips[i]) continue;
+        param_status_ptr[param_state->i_batch_offset + i] = param_state->row_with_info ? SQL_PARAM_SUCCESS_WITH_INFO : SQL_PARAM_SUCCESS;
+      }
+    }
+    return;
+  }
+
   size_t i_row_offset = 0;
   size_t i_row = 0;
   for (; i_row_offset < (size_t)param_state->nr_batch_size; ++i_row_offset) {
-    i_row = param_state->i_batch_offset + i_row_offset;
+    if (row_skips && row_skips[i_row_offset]) continue;
+
+    i_row = _param_state_row(param_state, i_row_offset);
     param_state->i_row      = (int)i_row;
+    param_state->i_bind     = (int)i_row_offset;
+
+    if (param_state->col_done && param_state->param_column->mem_done.base[i_row_offset]) {
+      if (param_status_ptr) {
+        param_status_ptr[i_row] = param_state->row_with_info ? SQL_PARAM_SUCCESS_WITH_INFO : SQL_PARAM_SUCCESS;
+      }
+      continue;
+    }
 
     if (param_status_ptr) {
       param_status_ptr[i_row] = SQL_PARAM_UNUSED;
@@ -7911,6 +9371,12 @@ static void _stmt_prepare_col_data(stmt_t *stmt, param_state_t *param_state)
       if (param_status_ptr) {
         param_status_ptr[i_row] = SQL_PARAM_ERROR;
       }
+      if (row_skips) {
+        row_skips[i_row_offset] = 1;
+        ++param_state->nr_batch_skipped;
+        param_state->rows_skipped = 1;
+        continue;
+      }
       param_state->row_err = 1;
       break;
     }
@@ -7923,6 +9389,296 @@ static void _stmt_prepare_col_data(stmt_t *stmt, param_state_t *param_state)
   param_state->nr_batch_size = (int)i_row_offset;
 }
 
+static void _stmt_param_status_set(stmt_t *stmt, param_state_t *param_state, size_t i_batch_offset, size_t nr_batch_size, SQLUSMALLINT status)
+{
+  SQLUSMALLINT *param_status_ptr = stmt_IPD(stmt)->header.DESC_ARRAY_STATUS_PTR;
+  if (!param_status_ptr) return;
+
+  for (size_t i = 0; i < nr_batch_size; ++i) {
+    size_t i_row = param_state->subtbl_rows ? param_state->subtbl_rows[i_batch_offset + i].i_row : i_batch_offset + i;
+    // NOTE: rows rejected by conversion keep their own status, see SQL_ATTR_TAOS_CONTINUE_ON_ERROR
+    if (param_status_ptr[i_row] == SQL_PARAM_ERROR) continue;
+    param_status_ptr[i_row] = status;
+  }
+}
+
+static SQLRETURN _stmt_param_compact_batch(stmt_t *stmt, param_state_t *param_state)
+{
+  const unsigned char *row_skips = param_state->row_skips.base;
+  const size_t nr_batch_size = (size_t)param_state->nr_batch_size;
+
+  for (int i_col = 0; i_col < param_state->nr_tsdb_fields; ++i_col) {
+    if (i_col == 0 && stmt->tsdb_stmt.is_insert_stmt && stmt->tsdb_stmt.params.subtbl_required) continue;
+
+    TAOS_MULTI_BIND      *mb           = stmt->tsdb_binds.mbs + i_col;
+    tsdb_param_column_t  *param_column = stmt->tsdb_paramset.params + i_col;
+
+    const size_t width = (size_t)mb->buffer_length;
+    unsigned char *src = (unsigned char*)mb->buffer;
+    unsigned char *dst = src;
+    if (src && src != param_column->mem.base) {
+      // NOTE: bound in place to the application buffer, which is never written to
+      if (mem_keep(&param_column->mem, width * nr_batch_size)) {
+        stmt_oom(stmt);
+        return SQL_ERROR;
+      }
+      dst = param_column->mem.base;
+    }
+
+    size_t j = 0;
+    for (size_t i = 0; i < nr_batch_size; ++i) {
+      if (row_skips[i]) continue;
+      if (dst && (dst != src || j != i)) memmove(dst + width * j, src + width * i, width);
+      if (mb->length)  mb->length[j]  = mb->length[i];
+      if (mb->is_null) mb->is_null[j] = mb->is_null[i];
+      ++j;
+    }
+    mb->buffer = dst;
+  }
+
+  return SQL_SUCCESS;
+}
+
+#define STMT_BATCH_ROWS_MIN              256
+// NOTE: taosc is only known to accept INT16_MAX rows per bind, thus BATCH_BYTES shrinks batches but never grows them beyond
+#define STMT_BATCH_ROWS_MAX              INT16_MAX
+#define STMT_SHARDS_MAX                  64
+
+static int64_t _stmt_batch_clock_ns(void)
+{
+#ifdef _WIN32               /* { */
+  LARGE_INTEGER ticks = {0}, freq = {0};
+  QueryPerformanceCounter(&ticks);
+  QueryPerformanceFrequency(&freq);
+  return (int64_t)((double)ticks.QuadPart * 1000000000 / freq.QuadPart);
+#else                       /* }{ */
+  struct timespec ts = {0};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif                      /* } */
+}
+
+static size_t _stmt_param_row_bytes(stmt_t *stmt)
+{
+  tsdb_params_t *tsdb_params = &stmt->tsdb_stmt.params;
+  size_t row_bytes = 0;
+
+  // NOTE: per row, the converted value plus its length and null indicator
+  for (int i = 0; i < tsdb_params->nr_tag_fields; ++i) {
+    row_bytes += (size_t)tsdb_params->tag_fields[i].bytes + sizeof(int32_t) + 1;
+  }
+  for (int i = 0; i < tsdb_params->nr_col_fields; ++i) {
+    row_bytes += (size_t)tsdb_params->col_fields[i].bytes + sizeof(int32_t) + 1;
+  }
+
+  return row_bytes ? row_bytes : 1;
+}
+
+static void _stmt_param_batcher_prepare(stmt_t *stmt)
+{
+  param_batcher_t *batcher = &stmt->param_batcher;
+  size_t budget = stmt->conn->cfg.batch_bytes;
+
+  batcher->rows_last = 0;
+
+  if (!budget || !stmt->tsdb_stmt.is_insert_stmt) {
+    batcher->enabled  = 0;
+    batcher->rows     = INT16_MAX;
+    batcher->rows_max = 0;
+    return;
+  }
+
+  size_t row_bytes = _stmt_param_row_bytes(stmt);
+  size_t rows_max  = budget / row_bytes;
+  if (rows_max < 1) rows_max = 1;
+  if (rows_max > STMT_BATCH_ROWS_MAX) rows_max = STMT_BATCH_ROWS_MAX;
+
+  if (!batcher->enabled || rows_max != batcher->rows_max) {
+    // NOTE: first insert or row layout changed, start over from what the legacy fixed size would be
+    batcher->rows_max = rows_max;
+    batcher->rows     = rows_max;
+    batcher->rate     = 0;
+    batcher->step     = 1;
+    batcher->enabled  = 1;
+  }
+
+  OD("batcher:%zd bytes per row, %zd rows at most, %zd rows next", row_bytes, rows_max, batcher->rows);
+}
+
+static void _stmt_param_batcher_feed(stmt_t *stmt, size_t nr_rows, int64_t elapsed_ns)
+{
+  param_batcher_t *batcher = &stmt->param_batcher;
+
+  batcher->rows_last = nr_rows;
+
+  if (!batcher->enabled) return;
+  // NOTE: short tail or subtbl group, tells nothing about the target size
+  if (nr_rows < batcher->rows || elapsed_ns <= 0) return;
+
+  double rate = (double)nr_rows * 1000000000 / elapsed_ns;
+  // NOTE: hill-climbing, turn around once throughput drops noticeably
+  if (batcher->rate > 0 && rate < batcher->rate * 0.95) batcher->step = -batcher->step;
+  batcher->rate = rate;
+
+  size_t rows_min = batcher->rows_max < STMT_BATCH_ROWS_MIN ? batcher->rows_max : STMT_BATCH_ROWS_MIN;
+  size_t rows = (batcher->step > 0) ? batcher->rows + batcher->rows / 4 + 1 : batcher->rows - batcher->rows / 5;
+  if (rows > batcher->rows_max) rows = batcher->rows_max;
+  if (rows < rows_min) rows = rows_min;
+
+  OD("batcher:%zd rows in %" PRId64 "ns, %.0f rows/s, %zd rows next", nr_rows, elapsed_ns, rate, rows);
+
+  batcher->rows = rows;
+}
+
+static SQLRETURN _stmt_execute_pipelined_wait(stmt_t *stmt, param_state_t *param_state)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  if (!param_state->pipelined) return SQL_SUCCESS;
+
+  sr = tsdb_stmt_execute_wait(&stmt->tsdb_stmt);
+  if (sr != SQL_SUCCESS) {
+    _stmt_param_status_set(stmt, param_state, param_state->i_pipelined_offset, param_state->nr_pipelined_size, SQL_PARAM_ERROR);
+    param_state->nr_pipelined_size = 0;
+    // NOTE: rows converted meanwhile have not been sent
+    _stmt_param_status_set(stmt, param_state, param_state->i_batch_offset, param_state->nr_batch_size, SQL_PARAM_UNUSED);
+    return SQL_ERROR;
+  }
+  param_state->nr_pipelined_size = 0;
+
+  if (param_state->subtbl_rows && param_state->i_batch_offset) {
+    const param_subtbl_row_t *row = param_state->subtbl_rows + param_state->i_batch_offset;
+    return _stmt_execute_rebind_subtbl(stmt, row->name, row->name_len);
+  }
+
+  return SQL_SUCCESS;
+}
+
+static size_t _tags_memo_value(const TAOS_MULTI_BIND *mb, const unsigned char **data, char *is_null)
+{
+  // NOTE: taosc takes tags from the first row
+  *is_null = mb->is_null ? mb->is_null[0] : 0;
+  *data    = (const unsigned char*)mb->buffer;
+  if (*is_null) return 0;
+  return mb->length ? (size_t)mb->length[0] : (size_t)mb->buffer_length;
+}
+
+static int _tags_memo_match(const mem_t *memo, const TAOS_MULTI_BIND *mbs, int nr)
+{
+  const unsigned char *p   = memo->base;
+  const unsigned char *end = memo->base + memo->nr;
+  if (!p) return 0;
+
+  for (int i = 0; i < nr; ++i) {
+    const unsigned char *data = NULL;
+    char is_null = 0;
+    size_t len = _tags_memo_value(mbs + i, &data, &is_null);
+    if ((size_t)(end - p) < 1 + sizeof(len) + len) return 0;
+    if (p[0] != (unsigned char)is_null) return 0;
+    size_t n = 0;
+    memcpy(&n, p + 1, sizeof(n));
+    if (n != len) return 0;
+    if (len && memcmp(p + 1 + sizeof(n), data, len)) return 0;
+    p += 1 + sizeof(n) + len;
+  }
+
+  return p == end;
+}
+
+static void _tags_memo_keep(mem_t *memo, const TAOS_MULTI_BIND *mbs, int nr)
+{
+  const unsigned char *data = NULL;
+  char is_null = 0;
+
+  size_t bytes = 0;
+  for (int i = 0; i < nr; ++i) {
+    bytes += 1 + sizeof(size_t) + _tags_memo_value(mbs + i, &data, &is_null);
+  }
+
+  mem_reset(memo);
+  // NOTE: an empty memo never matches
+  if (mem_keep(memo, bytes)) return;
+
+  unsigned char *p = memo->base;
+  for (int i = 0; i < nr; ++i) {
+    size_t len = _tags_memo_value(mbs + i, &data, &is_null);
+    p[0] = (unsigned char)is_null;
+    memcpy(p + 1, &len, sizeof(len));
+    if (len) memcpy(p + 1 + sizeof(len), data, len);
+    p += 1 + sizeof(len) + len;
+  }
+  memo->nr = bytes;
+}
+
+static SQLRETURN _stmt_execute_shard_wait(stmt_t *stmt, param_state_t *param_state, size_t i_shard)
+{
+  tsdb_shard_t *shard = stmt->tsdb_stmt.shards + i_shard;
+
+  SQLRETURN sr = tsdb_stmt_shard_execute_wait(&stmt->tsdb_stmt, i_shard);
+  if (sr != SQL_SUCCESS) {
+    _stmt_param_status_set(stmt, param_state, shard->i_batch_offset, shard->nr_batch_size, SQL_PARAM_ERROR);
+  }
+  shard->nr_batch_size = 0;
+
+  return sr;
+}
+
+static size_t _stmt_shard_of_batch(stmt_t *stmt, param_state_t *param_state)
+{
+  const param_subtbl_row_t *row = param_state->subtbl_rows + param_state->i_batch_offset;
+  return _param_subtbl_hash(row->name, row->name_len) % stmt->tsdb_stmt.nr_shards;
+}
+
+static SQLRETURN _stmt_execute_shard_batch(stmt_t *stmt, param_state_t *param_state, size_t i_shard)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const param_subtbl_row_t *row = param_state->subtbl_rows + param_state->i_batch_offset;
+  tsdb_shard_t *shard = stmt->tsdb_stmt.shards + i_shard;
+
+  TAOS_MULTI_BIND *tags = stmt->tsdb_binds.mbs + 1;
+  TAOS_MULTI_BIND *cols = tags + stmt->tsdb_stmt.params.nr_tag_fields;
+  sr = tsdb_stmt_shard_bind(&stmt->tsdb_stmt, i_shard, row->name, tags, cols);
+  if (sr != SQL_SUCCESS) {
+    _stmt_param_status_set(stmt, param_state, param_state->i_batch_offset, param_state->nr_batch_size, SQL_PARAM_ERROR);
+    return SQL_ERROR;
+  }
+
+  shard->i_batch_offset = param_state->i_batch_offset;
+  shard->nr_batch_size  = param_state->nr_batch_size;
+
+  sr = tsdb_stmt_shard_execute_start(&stmt->tsdb_stmt, i_shard);
+  if (sr != SQL_SUCCESS) {
+    // NOTE: executed in place and failed
+    _stmt_param_status_set(stmt, param_state, shard->i_batch_offset, shard->nr_batch_size, SQL_PARAM_ERROR);
+    shard->nr_batch_size = 0;
+    return SQL_ERROR;
+  }
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _stmt_execute_pipelined_end(stmt_t *stmt, param_state_t *param_state, SQLRETURN sr)
+{
+  if (param_state->sharded) {
+    for (size_t i = 0; i < stmt->tsdb_stmt.nr_shards; ++i) {
+      if (_stmt_execute_shard_wait(stmt, param_state, i) != SQL_SUCCESS) sr = SQL_ERROR;
+    }
+    return sr;
+  }
+
+  if (!param_state->pipelined) return sr;
+
+  if (tsdb_stmt_execute_wait(&stmt->tsdb_stmt) != SQL_SUCCESS) {
+    _stmt_param_status_set(stmt, param_state, param_state->i_pipelined_offset, param_state->nr_pipelined_size, SQL_PARAM_ERROR);
+    param_state->nr_pipelined_size = 0;
+    return SQL_ERROR;
+  }
+  param_state->nr_pipelined_size = 0;
+
+  return sr;
+}
+
 static SQLRETURN _stmt_execute_with_param_state(stmt_t *stmt, param_state_t *param_state)
 {
   SQLRETURN sr = SQL_SUCCESS;
@@ -7950,42 +9706,159 @@ static SQLRETURN _stmt_execute_with_param_state(stmt_t *stmt, param_state_t *par
     }
   }
 
-  for (size_t i_row = 0; i_row < nr_paramset_size; i_row += param_state->nr_batch_size) {
+  SQLUSMALLINT *param_status_ptr = IPD_header->DESC_ARRAY_STATUS_PTR;
+  if (param_status_ptr) {
+    for (size_t i_row = 0; i_row < nr_paramset_size; ++i_row) param_status_ptr[i_row] = SQL_PARAM_UNUSED;
+  }
+
+  param_state->pipelined = 0;
+  param_state->nr_pipelined_size = 0;
+  if (stmt->pipelined_insert && nr_paramset_size > 1 && stmt->base == &stmt->tsdb_stmt.base && stmt->tsdb_stmt.is_insert_stmt) {
+    param_state->pipelined = 1;
+#ifdef HAVE_TAOSWS           /* [ */
+    if (stmt->conn->cfg.url) param_state->pipelined = 0;
+#endif                       /* ] */
+  }
+
+  _stmt_param_batcher_prepare(stmt);
+
+  // NOTE: previous execute failed halfway, what taosc has bound is unknown
+  if (!stmt->tsdb_stmt.idle) stmt->tsdb_stmt.params.memo_valid = 0;
+
+  param_state->continue_on_error = stmt->continue_on_error && stmt->tsdb_stmt.is_insert_stmt;
+  param_state->rows_skipped = 0;
+  size_t nr_rows_sent = 0;
+
+  param_state->sharded = 0;
+  if (stmt->conn->cfg.parallel_insert > 1 && nr_paramset_size > 1 && stmt->base == &stmt->tsdb_stmt.base
+      && stmt->tsdb_stmt.is_insert_stmt && stmt->tsdb_stmt.params.subtbl_required)
+  {
+    param_state->sharded = 1;
+#ifdef HAVE_TAOSWS           /* [ */
+    if (stmt->conn->cfg.url) param_state->sharded = 0;
+#endif                       /* ] */
+  }
+  if (param_state->sharded) {
+    size_t nr_shards = stmt->conn->cfg.parallel_insert;
+    if (nr_shards > STMT_SHARDS_MAX) nr_shards = STMT_SHARDS_MAX;
+    sr = tsdb_stmt_shards_prepare(&stmt->tsdb_stmt, nr_shards);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+    // NOTE: shards execute asynchronously by themselves
+    param_state->pipelined = 0;
+  }
+
+  param_state->subtbl_rows = NULL;
+  if (nr_paramset_size > 1 && stmt->tsdb_stmt.is_insert_stmt && stmt->tsdb_stmt.params.subtbl_required) {
+    // NOTE: group rows by subtbl, thus interleaved paramsets are bound one subtbl a batch rather than row by row
+    //       subtbls are sent in the order they first appear in the paramset, rows of a subtbl in paramset order,
+    //       rows whose subtbl could not be fetched are marked SQL_PARAM_ERROR and counted as processed upfront
+    param_state->is_subtbl = 1;
+    sr = _stmt_plan_subtbl(stmt, param_state, nr_paramset_size);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+    if (param_state->nr_subtbl_rejected) {
+      param_state->rows_skipped = 1;
+      nr_params_processed += (SQLULEN)param_state->nr_subtbl_rejected;
+      if (params_processed_ptr) *params_processed_ptr = nr_params_processed;
+    }
+  }
+
+  const size_t nr_rows = param_state->subtbl_rows ? param_state->nr_subtbl_rows : nr_paramset_size;
+  for (size_t i_row = 0; i_row < nr_rows; i_row += param_state->nr_batch_size) {
+    if (atomic_load(&stmt->cancelled)) return _stmt_execute_pipelined_end(stmt, param_state, SQL_ERROR);
+    int64_t t0 = _stmt_batch_clock_ns();
+    // NOTE: set again once executed successfully, see STMT_CACHE
+    stmt->tsdb_stmt.idle = 0;
+    size_t nr_batch_size = nr_rows - i_row;
+    if (nr_batch_size > stmt->param_batcher.rows) nr_batch_size = stmt->param_batcher.rows;
+    if (param_state->subtbl_rows) {
+      nr_batch_size = _param_state_subtbl_group_size(param_state, i_row, nr_batch_size);
+    }
     param_state->i_batch_offset = i_row;
-    param_state->nr_batch_size = (int)(nr_paramset_size - i_row);
-    if (param_state->nr_batch_size > INT16_MAX) param_state->nr_batch_size = INT16_MAX;
+    param_state->nr_batch_size = (int)nr_batch_size;
 
     param_state->row_with_info = 0;
     param_state->row_err = 0;
 
+    param_state->nr_batch_skipped = 0;
+    if (param_state->continue_on_error) {
+      r = mem_keep(&param_state->row_skips, nr_batch_size);
+      if (r) {
+        stmt_oom(stmt);
+        return _stmt_execute_pipelined_end(stmt, param_state, SQL_ERROR);
+      }
+      memset(param_state->row_skips.base, 0, nr_batch_size);
+    }
+
     for (size_t i_col = 0; i_col < (size_t)param_state->nr_tsdb_fields; ++i_col) {
       param_state->i_param    = (int)i_col;
       param_state->APD_record = APD->records + i_col;
       param_state->IPD_record = IPD->records + i_col;
 
       sr = _stmt_prepare_col(stmt, param_state);
-      if (sr != SQL_SUCCESS) return sr;
+      if (sr != SQL_SUCCESS) return _stmt_execute_pipelined_end(stmt, param_state, sr);
 
       _stmt_prepare_col_data(stmt, param_state);
 
       if (param_state->nr_batch_size == 0) {
         if (i_row == 0) return SQL_ERROR;
-        return SQL_SUCCESS;
+        return _stmt_execute_pipelined_end(stmt, param_state, SQL_SUCCESS);
       }
     }
 
+    sr = _stmt_execute_pipelined_wait(stmt, param_state);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+
     nr_params_processed += param_state->nr_batch_size;
     if (params_processed_ptr) *params_processed_ptr = nr_params_processed;
 
+    if (param_state->nr_batch_skipped) {
+      // NOTE: every row of the batch rejected, nothing to send
+      if (param_state->nr_batch_skipped == param_state->nr_batch_size) continue;
+      sr = _stmt_param_compact_batch(stmt, param_state);
+      if (sr != SQL_SUCCESS) return _stmt_execute_pipelined_end(stmt, param_state, SQL_ERROR);
+    }
+
     for (size_t i=0; i<(size_t)param_state->nr_tsdb_fields; ++i) {
       TAOS_MULTI_BIND *mbs = stmt->tsdb_binds.mbs + i;
-      mbs->num = (int)param_state->nr_batch_size;
+      mbs->num = param_state->nr_batch_size - param_state->nr_batch_skipped;
     }
+    nr_rows_sent += (size_t)(param_state->nr_batch_size - param_state->nr_batch_skipped);
+
+    if (param_state->sharded) {
+      size_t i_shard = _stmt_shard_of_batch(stmt, param_state);
+      // NOTE: rows of the same subtbl always land in the same shard, thus stay in order
+      sr = _stmt_execute_shard_wait(stmt, param_state, i_shard);
+      if (sr != SQL_SUCCESS) {
+        // NOTE: the previous batch of the shard failed, this one is never sent, thus neither processed
+        _stmt_param_status_set(stmt, param_state, param_state->i_batch_offset, param_state->nr_batch_size, SQL_PARAM_UNUSED);
+        nr_params_processed -= (SQLULEN)(param_state->nr_batch_size - param_state->nr_batch_skipped);
+        if (params_processed_ptr) *params_processed_ptr = nr_params_processed;
+        return _stmt_execute_pipelined_end(stmt, param_state, SQL_ERROR);
+      }
+
+      sr = _stmt_execute_shard_batch(stmt, param_state, i_shard);
+      if (sr != SQL_SUCCESS) return _stmt_execute_pipelined_end(stmt, param_state, SQL_ERROR);
+
+      _stmt_param_batcher_feed(stmt, (size_t)param_state->nr_batch_size, _stmt_batch_clock_ns() - t0);
+
+      if (param_state->row_err) return _stmt_execute_pipelined_end(stmt, param_state, SQL_SUCCESS_WITH_INFO);
+      continue;
+    }
+
+    // NOTE: might have been set by the pipelined execute of the previous batch
+    stmt->tsdb_stmt.idle = 0;
 
     tsdb_params_t *tsdb_params = &stmt->tsdb_stmt.params;
     if (stmt->tsdb_stmt.is_insert_stmt) {
-      if (tsdb_params->nr_tag_fields) {
-        TAOS_MULTI_BIND *mbs = stmt->tsdb_binds.mbs + (!!stmt->tsdb_stmt.params.subtbl_required);
+      TAOS_MULTI_BIND *mbs = stmt->tsdb_binds.mbs + (!!stmt->tsdb_stmt.params.subtbl_required);
+      if (tsdb_params->nr_tag_fields && !(tsdb_params->memo_valid && _tags_memo_match(&tsdb_params->tags_memo, mbs, tsdb_params->nr_tag_fields))) {
+        // NOTE: same subtbl as the last execute, thus set_tbname was skipped, re-issued since set_tags alone is not
+        //       known to be accepted by taosc/taosws on an executed statement
+        if (tsdb_params->memo_valid) {
+          sr = tsdb_stmt_set_tbname(&stmt->tsdb_stmt);
+          if (sr != SQL_SUCCESS) return SQL_ERROR;
+        }
+        tsdb_params->memo_valid = 0;
 #ifdef HAVE_TAOSWS           /* [ */
         if (stmt->conn->cfg.url) {
           r = CALL_ws_stmt_set_tags((WS_STMT*)stmt->tsdb_stmt.stmt, (WS_MULTI_BIND*)mbs, tsdb_params->nr_tag_fields);
@@ -8003,6 +9876,7 @@ static SQLRETURN _stmt_execute_with_param_state(stmt_t *stmt, param_state_t *par
 #ifdef HAVE_TAOSWS           /* [ */
         }
 #endif                       /* ] */
+        _tags_memo_keep(&tsdb_params->tags_memo, mbs, tsdb_params->nr_tag_fields);
       }
     }
 
@@ -8044,16 +9918,34 @@ static SQLRETURN _stmt_execute_with_param_state(stmt_t *stmt, param_state_t *par
     }
 #endif                       /* ] */
 
-    sr = stmt->base->execute(stmt->base);
+    if (param_state->pipelined) {
+      // NOTE: recorded before the worker starts, thus the rows are known if its execute fails
+      param_state->i_pipelined_offset = param_state->i_batch_offset;
+      param_state->nr_pipelined_size  = param_state->nr_batch_size;
+      sr = tsdb_stmt_execute_start(&stmt->tsdb_stmt);
+      if (sr != SQL_SUCCESS) {
+        // NOTE: executed in place and failed
+        _stmt_param_status_set(stmt, param_state, param_state->i_pipelined_offset, param_state->nr_pipelined_size, SQL_PARAM_ERROR);
+        param_state->nr_pipelined_size = 0;
+      }
+    } else {
+      sr = stmt->base->execute(stmt->base);
+    }
     if (sr != SQL_SUCCESS) return SQL_ERROR;
 #ifdef USE_TICK_TO_DEBUG                 /* { */
     _stmt_reset_ticks(stmt);
 #endif                                   /* } */
 
-    if (param_state->row_err) return SQL_SUCCESS_WITH_INFO;
+    _stmt_param_batcher_feed(stmt, (size_t)param_state->nr_batch_size, _stmt_batch_clock_ns() - t0);
+
+    if (param_state->row_err) return _stmt_execute_pipelined_end(stmt, param_state, SQL_SUCCESS_WITH_INFO);
   }
 
-  return SQL_SUCCESS;
+  if (param_state->rows_skipped) {
+    return _stmt_execute_pipelined_end(stmt, param_state, nr_rows_sent ? SQL_SUCCESS_WITH_INFO : SQL_ERROR);
+  }
+
+  return _stmt_execute_pipelined_end(stmt, param_state, SQL_SUCCESS);
 }
 
 static SQLRETURN _stmt_execute_with_params(stmt_t *stmt)
@@ -8103,7 +9995,7 @@ static SQLRETURN _stmt_execute_with_params(stmt_t *stmt)
   return _stmt_execute_with_param_state(stmt, param_state);
 }
 
-static SQLRETURN _stmt_execute(stmt_t *stmt)
+static SQLRETURN _stmt_execute_untimed(stmt_t *stmt)
 {
   descriptor_t *APD = stmt_APD(stmt);
   desc_header_t *APD_header = &APD->header;
@@ -8128,6 +10020,43 @@ static SQLRETURN _stmt_execute(stmt_t *stmt)
   return sr;
 }
 
+static void _stmt_query_timeout_fire(void *arg)
+{
+  stmt_t *stmt = (stmt_t*)arg;
+  // NOTE: called on the timer worker, the statement is still executing since disarming waits for us
+  //       taos_kill_query is connection-wide, thus requests of other statements on the same connection are killed as well
+  CALL_taos_kill_query((TAOS*)stmt->conn->ds_conn.taos);
+}
+
+static SQLRETURN _stmt_execute_timed(stmt_t *stmt)
+{
+  if (!stmt->query_timeout) return _stmt_execute_untimed(stmt);
+
+  env_t *env = stmt->conn->env;
+  query_timer_t *timer = &stmt->query_timer;
+  timer->fire = _stmt_query_timeout_fire;
+  timer->arg  = stmt;
+  if (env_timer_arm(env, timer, (int64_t)stmt->query_timeout)) {
+    stmt_append_err(stmt, "HY000", 0, "General error:arming timer for `SQL_ATTR_QUERY_TIMEOUT` failed");
+    return SQL_ERROR;
+  }
+
+  SQLRETURN sr = _stmt_execute_untimed(stmt);
+
+  if (env_timer_disarm(env, timer) && sr == SQL_ERROR) {
+    stmt_clr_errs(stmt);
+    stmt_append_err_format(stmt, "HYT00", 0, "Timeout expired:`SQL_ATTR_QUERY_TIMEOUT` of %zd seconds", (size_t)stmt->query_timeout);
+  }
+  return sr;
+}
+
+static SQLRETURN _stmt_execute(stmt_t *stmt)
+{
+  _stmt_cancel_enter(stmt);
+  SQLRETURN sr = _stmt_execute_timed(stmt);
+  return _stmt_cancel_leave(stmt, sr);
+}
+
 static SQLRETURN _stmt_exec_direct(stmt_t *stmt)
 {
   SQLRETURN sr = SQL_SUCCESS;
@@ -8391,7 +10320,8 @@ SQLRETURN stmt_set_attr(stmt_t *stmt, SQLINTEGER Attribute, SQLPOINTER ValuePtr,
       }
       break;
     case SQL_ATTR_CURSOR_SCROLLABLE:
-      if ((SQLULEN)(uintptr_t)ValuePtr == SQL_NONSCROLLABLE) return SQL_SUCCESS;
+      if ((SQLULEN)(uintptr_t)ValuePtr == SQL_NONSCROLLABLE) return _stmt_set_cursor_type(stmt, SQL_CURSOR_FORWARD_ONLY);
+      if ((SQLULEN)(uintptr_t)ValuePtr == SQL_SCROLLABLE) return _stmt_set_cursor_type(stmt, SQL_CURSOR_STATIC);
       break;
     case SQL_ATTR_CURSOR_SENSITIVITY:
       if ((SQLULEN)(uintptr_t)ValuePtr == SQL_UNSPECIFIED) return SQL_SUCCESS;
@@ -8435,6 +10365,11 @@ SQLRETURN stmt_set_attr(stmt_t *stmt, SQLINTEGER Attribute, SQLPOINTER ValuePtr,
     case SQL_ATTR_PARAMSET_SIZE:
       return _stmt_set_paramset_size(stmt, (SQLULEN)ValuePtr);
     case SQL_ATTR_QUERY_TIMEOUT:
+      if (!conn_is_ws_backended(stmt->conn)) {
+        stmt->query_timeout = (SQLULEN)(uintptr_t)ValuePtr;
+        return SQL_SUCCESS;
+      }
+      // NOTE: websocket backend has no way to interrupt a running query yet
       if ((SQLULEN)(uintptr_t)ValuePtr == 0) return SQL_SUCCESS;
       stmt_append_err_format(stmt, "01S02", 0, "Option value changed:`%zd` for `SQL_ATTR_QUERY_TIMEOUT` is substituted by `0`", (SQLULEN)(uintptr_t)ValuePtr);
       return SQL_SUCCESS_WITH_INFO;
@@ -8464,6 +10399,18 @@ SQLRETURN stmt_set_attr(stmt_t *stmt, SQLINTEGER Attribute, SQLPOINTER ValuePtr,
     case SQL_ROWSET_SIZE:
       return _stmt_set_row_array_size(stmt, (SQLULEN)ValuePtr);
       break;
+    case SQL_ATTR_TAOS_PIPELINED_INSERT:
+      if ((SQLULEN)(uintptr_t)ValuePtr == SQL_TAOS_PIPELINED_INSERT_OFF || (SQLULEN)(uintptr_t)ValuePtr == SQL_TAOS_PIPELINED_INSERT_ON) {
+        stmt->pipelined_insert = ((SQLULEN)(uintptr_t)ValuePtr == SQL_TAOS_PIPELINED_INSERT_ON);
+        return SQL_SUCCESS;
+      }
+      break;
+    case SQL_ATTR_TAOS_CONTINUE_ON_ERROR:
+      if ((SQLULEN)(uintptr_t)ValuePtr == SQL_TAOS_CONTINUE_ON_ERROR_OFF || (SQLULEN)(uintptr_t)ValuePtr == SQL_TAOS_CONTINUE_ON_ERROR_ON) {
+        stmt->continue_on_error = ((SQLULEN)(uintptr_t)ValuePtr == SQL_TAOS_CONTINUE_ON_ERROR_ON);
+        return SQL_SUCCESS;
+      }
+      break;
     default:
       break;
   }
@@ -8502,7 +10449,8 @@ SQLRETURN stmt_get_attr(stmt_t *stmt,
       *(SQLULEN*)Value = stmt->concurrency_attr;
       return SQL_SUCCESS;
     case SQL_ATTR_CURSOR_SCROLLABLE:
-      break;
+      *(SQLULEN*)Value = (stmt->cursor_type == SQL_CURSOR_FORWARD_ONLY) ? SQL_NONSCROLLABLE : SQL_SCROLLABLE;
+      return SQL_SUCCESS;
     case SQL_ATTR_CURSOR_SENSITIVITY:
       break;
     case SQL_ATTR_CURSOR_TYPE:
@@ -8541,7 +10489,7 @@ SQLRETURN stmt_get_attr(stmt_t *stmt,
     case SQL_ATTR_PARAMSET_SIZE:
       break;
     case SQL_ATTR_QUERY_TIMEOUT:
-      *(SQLULEN*)Value = 0;
+      *(SQLULEN*)Value = stmt->query_timeout;
       return SQL_SUCCESS;
     case SQL_ATTR_RETRIEVE_DATA:
       break;
@@ -8567,6 +10515,15 @@ SQLRETURN stmt_get_attr(stmt_t *stmt,
     case SQL_ROWSET_SIZE:
       *(SQLULEN*)Value = (SQLULEN)_stmt_get_row_array_size(stmt);
       return SQL_SUCCESS;
+    case SQL_ATTR_TAOS_PIPELINED_INSERT:
+      *(SQLULEN*)Value = stmt->pipelined_insert ? SQL_TAOS_PIPELINED_INSERT_ON : SQL_TAOS_PIPELINED_INSERT_OFF;
+      return SQL_SUCCESS;
+    case SQL_ATTR_TAOS_INSERT_BATCH_ROWS:
+      *(SQLULEN*)Value = (SQLULEN)stmt->param_batcher.rows_last;
+      return SQL_SUCCESS;
+    case SQL_ATTR_TAOS_CONTINUE_ON_ERROR:
+      *(SQLULEN*)Value = stmt->continue_on_error ? SQL_TAOS_CONTINUE_ON_ERROR_ON : SQL_TAOS_CONTINUE_ON_ERROR_OFF;
+      return SQL_SUCCESS;
     default:
       break;
   }
@@ -287,6 +287,7 @@ static SQLRETURN _poll(topic_t *topic)
   SQLRETURN sr = SQL_SUCCESS;
 
   while (topic->res == NULL) {
+    if (stmt_is_cancelled(topic->owner)) return SQL_ERROR;
     if (topic->records_max >= 0 && topic->records_count >= topic->records_max) {
       stmt_append_err_format(topic->owner, "HY000", 0, "General error:taos_odbc.limit.records[%" PRId64 "] has been reached", topic->records_max);
       return SQL_NO_DATA;
@@ -26,8 +26,11 @@
 
 #include "tsdb.h"
 
+#include "conn.h"
 #include "desc.h"
+#include "ds.h"
 #include "errs.h"
+#include "fmt.h"
 #include "log.h"
 #include "stmt.h"
 #include "taos_helpers.h"
@@ -37,38 +40,136 @@
 
 #include <errno.h>
 
+#define TSDB_CURSOR_CACHE_SIZE_DEFAULT          64            // in MB, see CURSOR_CACHE_SIZE
+
+#define TSDB_TZ_PROBE_SECONDS                   86400         // NOTE: assuming no two tz-transitions within a day
+
+static void _tsdb_civil_from_days(int64_t z, struct tm *tm)
+{
+  z += 719468;
+  int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  int64_t doe = z - era * 146097;
+  int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  int64_t mp  = (5 * doy + 2) / 153;
+  int     d   = (int)(doy - (153 * mp + 2) / 5 + 1);
+  int     m   = (int)(mp < 10 ? mp + 3 : mp - 9);
+  int64_t y   = yoe + era * 400 + (m <= 2);
+
+  tm->tm_year = (int)(y - 1900);
+  tm->tm_mon  = m - 1;
+  tm->tm_mday = d;
+}
+
+static int _tsdb_local_gmtoff(int64_t t, int64_t *gmtoff, int *isdst)
+{
+  time_t tt = (time_t)t;
+  struct tm tm = {0};
+  struct tm *p = localtime_r(&tt, &tm);
+  if (p != &tm) return -1;
+
+  int64_t local = tod_days_from_civil(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday) * 86400
+                + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+  *gmtoff = local - t;
+  if (isdst) *isdst = tm.tm_isdst;
+  return 0;
+}
+
+static int _tsdb_tz_window_edge(int64_t in, int64_t out, int64_t gmtoff, int64_t *edge)
+{
+  // NOTE: bisect for the first second that is no longer of `gmtoff`, `in` is of `gmtoff`, `out` is not
+  while (in - out > 1 || out - in > 1) {
+    int64_t mid = in + (out - in) / 2;
+    int64_t v;
+    if (_tsdb_local_gmtoff(mid, &v, NULL)) return -1;
+    if (v == gmtoff) in  = mid;
+    else             out = mid;
+  }
+  *edge = out;
+  return 0;
+}
+
+static int _tsdb_tz_window_load(tsdb_tz_window_t *win, int64_t t)
+{
+  int64_t gmtoff, v;
+  int isdst;
+  if (_tsdb_local_gmtoff(t, &gmtoff, &isdst)) return -1;
+
+  int64_t lo = t - TSDB_TZ_PROBE_SECONDS;
+  int64_t hi = t + TSDB_TZ_PROBE_SECONDS;
+
+  if (_tsdb_local_gmtoff(lo, &v, NULL)) return -1;
+  if (v != gmtoff) {
+    if (_tsdb_tz_window_edge(t, lo, gmtoff, &lo)) return -1;
+    lo += 1;
+  }
+
+  if (_tsdb_local_gmtoff(hi - 1, &v, NULL)) return -1;
+  if (v != gmtoff) {
+    if (_tsdb_tz_window_edge(t, hi - 1, gmtoff, &hi)) return -1;
+  }
+
+  win->lo     = lo;
+  win->hi     = hi;
+  win->gmtoff = gmtoff;
+  win->isdst  = isdst;
+  return 0;
+}
+
 static int _tsdb_timestamp_to_tm_local(int64_t val, int time_precision, struct tm *tm, int32_t *fraction, int *w)
 {
-  time_t  tt;
+  // NOTE: localtime_r takes the libc tz lock per call, thus cache the utc-offset of the time window around the last timestamp
+  //       it's per-thread and never invalidated, thus changing TZ at runtime is not honored
+  //       tz-transitions are located by probing localtime_r at +/-TSDB_TZ_PROBE_SECONDS, which assumes at most one transition
+  //       on either side within that distance, true for every tzdata zone we know of
+  static TOD_THREAD_LOCAL tsdb_tz_window_t win;
+
+  int64_t tt;
   int32_t xfraction = 0;
+  int32_t base;
   int xw;
   switch (time_precision) {
     case 2:
-      tt = (time_t)(val / 1000000000);
-      xfraction = val % 1000000000;
+      base = 1000000000;
       xw = 9;
       break;
     case 1:
-      tt = (time_t)(val / 1000000);
-      xfraction = val % 1000000;
+      base = 1000000;
       xw = 6;
       break;
     case 0:
-      tt = (time_t)(val / 1000);
-      xfraction = val % 1000;
+      base = 1000;
       xw = 3;
       break;
     default:
       OA_ILE(0);
-      break;
+      return -1;
+  }
+
+  // NOTE: floor rather than truncate, thus pre-1970 timestamps carry a non-negative fraction of the second before
+  tt = val / base;
+  xfraction = (int32_t)(val % base);
+  if (xfraction < 0) {
+    xfraction += base;
+    --tt;
   }
 
-  if (tt <= 0 && xfraction < 0) {
-    OA_NIY(0);
+  if (win.lo >= win.hi || tt < win.lo || tt >= win.hi) {
+    if (_tsdb_tz_window_load(&win, tt)) return -1;
   }
 
-  struct tm *p = localtime_r(&tt, tm);
-  if (p != tm) return -1;
+  int64_t local = tt + win.gmtoff;
+  int64_t days  = (local >= 0 ? local : local - 86399) / 86400;
+  int64_t secs  = local - days * 86400;
+
+  _tsdb_civil_from_days(days, tm);
+  tm->tm_hour  = (int)(secs / 3600);
+  tm->tm_min   = (int)(secs % 3600 / 60);
+  tm->tm_sec   = (int)(secs % 60);
+  tm->tm_wday  = (int)((days % 7 + 11) % 7);     // NOTE: 1970-01-01 is Thursday
+  tm->tm_yday  = (int)(days - tod_days_from_civil(tm->tm_year + 1900, 1, 1));
+  tm->tm_isdst = win.isdst;
+
   if (fraction) *fraction = xfraction;
   if (w)  *w  = xw;
   return 0;
@@ -111,6 +212,8 @@ int tsdb_timestamp_to_string(int64_t val, int time_precision, char *buf, size_t
   int r = _tsdb_timestamp_to_tm_local(val, time_precision, &ptm, &fraction, &w);
   if (r) return -1;
 
+  if (len > FMT_MAX) return (int)fmt_timestamp(buf, &ptm, fraction, w);
+
   n = snprintf(buf, len,
       "%04d-%02d-%02d %02d:%02d:%02d.%0*d",
       ptm.tm_year + 1900, ptm.tm_mon + 1, ptm.tm_mday,
@@ -127,6 +230,7 @@ static void _tsdb_param_column_release(tsdb_param_column_t *pa)
   mem_release(&pa->mem);
   mem_release(&pa->mem_is_null);
   mem_release(&pa->mem_length);
+  mem_release(&pa->mem_done);
 }
 
 void tsdb_paramset_reset(tsdb_paramset_t *paramset)
@@ -223,12 +327,16 @@ static void _tsdb_params_reset(tsdb_params_t *params)
   TOD_SAFE_FREE(params->subtbl);
   params->subtbl_required = 0;
 
+  mem_reset(&params->tags_memo);
+  params->memo_valid = 0;
+
   params->qms = 0;
 }
 
 static void _tsdb_params_release(tsdb_params_t *params)
 {
   _tsdb_params_reset(params);
+  mem_release(&params->tags_memo);
 
   params->owner = NULL;
 }
@@ -266,18 +374,433 @@ static void _tsdb_rows_block_reset(tsdb_rows_block_t *rows_block)
   rows_block->ws_ptr               = NULL;
   rows_block->nr                   = 0;
   rows_block->pos                  = 0;
+  for (size_t i=0; i<rows_block->cols_cap; ++i) {
+    tsdb_rows_block_col_t *col = rows_block->cols + i;
+    col->offsets                   = NULL;
+    col->offsets_ready             = 0;
+    col->nulls_ready               = 0;
+  }
 }
 
 static void _tsdb_rows_block_release(tsdb_rows_block_t *rows_block)
 {
   if (!rows_block) return;
   _tsdb_rows_block_reset(rows_block);
+  for (size_t i=0; i<rows_block->cols_cap; ++i) {
+    tsdb_rows_block_col_t *col = rows_block->cols + i;
+    TOD_SAFE_FREE(col->nulls);
+    col->cap = 0;
+  }
+  TOD_SAFE_FREE(rows_block->cols);
+  rows_block->cols_cap = 0;
+}
+
+static int _tsdb_data_type_is_var(int8_t type)
+{
+  switch (type) {
+    case TSDB_DATA_TYPE_VARCHAR:
+    case TSDB_DATA_TYPE_NCHAR:
+    case TSDB_DATA_TYPE_JSON:
+    case TSDB_DATA_TYPE_VARBINARY:
+    case TSDB_DATA_TYPE_GEOMETRY:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+static tsdb_rows_block_col_t* _tsdb_rows_block_keep_col(tsdb_rows_block_t *rows_block, int i_col)
+{
+  if ((size_t)i_col >= rows_block->cols_cap) {
+    size_t cap = ((size_t)i_col + 1 + 15) / 16 * 16;
+    tsdb_rows_block_col_t *cols = (tsdb_rows_block_col_t*)realloc(rows_block->cols, cap * sizeof(*cols));
+    if (!cols) return NULL;
+    memset(cols + rows_block->cols_cap, 0, sizeof(*cols) * (cap - rows_block->cols_cap));
+    rows_block->cols     = cols;
+    rows_block->cols_cap = cap;
+  }
+
+  tsdb_rows_block_col_t *col = rows_block->cols + i_col;
+
+  if (rows_block->nr > col->cap) {
+    size_t cap = (rows_block->nr + 15) / 16 * 16;
+    bool *nulls = (bool*)realloc(col->nulls, cap * sizeof(*nulls));
+    if (!nulls) return NULL;
+    col->nulls = nulls;
+    col->cap   = cap;
+  }
+
+  return col;
+}
+
+static tsdb_rows_block_col_t* _tsdb_res_get_block_col(tsdb_res_t *res, int i_col)
+{
+  tsdb_rows_block_t *rows_block = &res->rows_block;
+  TAOS_FIELD        *field      = res->fields.fields + i_col;
+
+  tsdb_rows_block_col_t *col = _tsdb_rows_block_keep_col(rows_block, i_col);
+  if (!col) return NULL;
+
+  if (!col->nulls_ready) {
+    int nr_rows = (int)rows_block->nr;
+    int r = CALL_taos_is_null_by_column(res->res, i_col, col->nulls, &nr_rows);
+    if (r || (size_t)nr_rows != rows_block->nr) {
+      // NOTE: fall back to check cell by cell, still once per block
+      for (size_t i=0; i<rows_block->nr; ++i) {
+        col->nulls[i] = CALL_taos_is_null(res->res, (int32_t)i, i_col);
+      }
+    }
+    col->nulls_ready = 1;
+  }
+
+  if (!col->offsets_ready) {
+    if (_tsdb_data_type_is_var(field->type)) {
+      col->offsets = CALL_taos_get_column_data_offset(res->res, i_col);
+    }
+    col->offsets_ready = 1;
+  }
+
+  return col;
+}
+
+const bool* tsdb_res_get_col_nulls(tsdb_res_t *res, int i_col)
+{
+  tsdb_rows_block_col_t *col = _tsdb_res_get_block_col(res, i_col);
+  return col ? col->nulls : NULL;
+}
+
+static size_t _tsdb_res_block_col_bytes(tsdb_res_t *res, tsdb_rows_block_col_t *col, int i_col)
+{
+  tsdb_rows_block_t *rows_block = &res->rows_block;
+  TAOS_FIELD        *field      = res->fields.fields + i_col;
+  const char        *data       = (const char*)rows_block->rows[i_col];
+
+  if (!col->offsets) return rows_block->nr * (size_t)field->bytes;
+
+  size_t bytes = 0;
+  for (size_t i=0; i<rows_block->nr; ++i) {
+    if (col->offsets[i] < 0) continue;
+    size_t end = (size_t)col->offsets[i] + sizeof(int16_t) + *(const uint16_t*)(data + col->offsets[i]);
+    if (end > bytes) bytes = end;
+  }
+  return bytes;
+}
+
+static int _tsdb_res_snapshot_block(tsdb_res_t *res)
+{
+  tsdb_rows_block_t *rows_block = &res->rows_block;
+  tsdb_prefetch_t   *prefetch   = &res->prefetch;
+  size_t             nr_cols    = res->fields.nr;
+
+  if (nr_cols > prefetch->cols_cap) {
+    size_t cap = (nr_cols + 15) / 16 * 16;
+    void **cols = (void**)realloc(prefetch->cols, cap * sizeof(*cols));
+    if (!cols) return -1;
+    prefetch->cols     = cols;
+    prefetch->cols_cap = cap;
+  }
+
+  // NOTE: 1st pass, decode nulls/offsets while they are still in taosc's buffers, and size the copy
+  size_t bytes = 0;
+  for (size_t i=0; i<nr_cols; ++i) {
+    tsdb_rows_block_col_t *col = _tsdb_res_get_block_col(res, (int)i);
+    if (!col) return -1;
+    size_t n = _tsdb_res_block_col_bytes(res, col, (int)i);
+    prefetch->cols[i] = (void*)(uintptr_t)n;
+    bytes += (n + 7) / 8 * 8;
+    if (col->offsets) bytes += (rows_block->nr * sizeof(int) + 7) / 8 * 8;
+  }
+
+  if (bytes > prefetch->cap) {
+    size_t cap = (bytes + 4095) / 4096 * 4096;
+    char *buf = (char*)realloc(prefetch->buf, cap);
+    if (!buf) return -1;
+    prefetch->buf = buf;
+    prefetch->cap = cap;
+  }
+
+  char *p = prefetch->buf;
+  for (size_t i=0; i<nr_cols; ++i) {
+    tsdb_rows_block_col_t *col = rows_block->cols + i;
+    size_t n = (size_t)(uintptr_t)prefetch->cols[i];
+    if (col->offsets) {
+      memcpy(p, col->offsets, rows_block->nr * sizeof(int));
+      col->offsets = (const int*)p;
+      p += (rows_block->nr * sizeof(int) + 7) / 8 * 8;
+    }
+    if (n) memcpy(p, rows_block->rows[i], n);
+    prefetch->cols[i] = p;
+    p += (n + 7) / 8 * 8;
+  }
+
+  rows_block->rows = prefetch->cols;
+  return 0;
+}
+
+static void _tsdb_res_prefetch_done(void *param, TAOS_RES *taos_res, int code)
+{
+  (void)taos_res;
+  tsdb_prefetch_t *prefetch = (tsdb_prefetch_t*)param;
+
+  pthread_mutex_lock(&prefetch->mutex);
+  prefetch->nr_rows = code;
+  prefetch->done    = 1;
+  pthread_cond_signal(&prefetch->cond);
+  pthread_mutex_unlock(&prefetch->mutex);
+}
+
+static void _tsdb_res_prefetch_issue(tsdb_res_t *res)
+{
+  tsdb_prefetch_t *prefetch = &res->prefetch;
+
+  // NOTE: the callback might be fired before taos_fetch_rows_a returns
+  prefetch->done    = 0;
+  prefetch->pending = 1;
+  CALL_taos_fetch_rows_a(res->res, _tsdb_res_prefetch_done, prefetch);
+}
+
+static int _tsdb_res_prefetch_wait(tsdb_res_t *res)
+{
+  tsdb_prefetch_t *prefetch = &res->prefetch;
+
+  pthread_mutex_lock(&prefetch->mutex);
+  while (!prefetch->done) pthread_cond_wait(&prefetch->cond, &prefetch->mutex);
+  pthread_mutex_unlock(&prefetch->mutex);
+  prefetch->pending = 0;
+
+  return prefetch->nr_rows;
+}
+
+static void _tsdb_prefetch_release(tsdb_prefetch_t *prefetch)
+{
+  TOD_SAFE_FREE(prefetch->cols);
+  prefetch->cols_cap = 0;
+  TOD_SAFE_FREE(prefetch->buf);
+  prefetch->cap = 0;
+  if (prefetch->inited) {
+    pthread_cond_destroy(&prefetch->cond);
+    pthread_mutex_destroy(&prefetch->mutex);
+    prefetch->inited = 0;
+  }
+}
+
+static void _tsdb_res_cache_reset(tsdb_res_cache_t *cache)
+{
+  for (size_t i=0; i<cache->nr; ++i) {
+    TOD_SAFE_FREE(cache->blocks[i].buf);
+  }
+  cache->nr          = 0;
+  cache->nr_rows     = 0;
+  cache->current     = 0;
+  cache->mem_bytes   = 0;
+  if (cache->spill) {
+    fclose(cache->spill);
+    cache->spill = NULL;
+  }
+  cache->spill_bytes = 0;
+  cache->loaded      = 0;
+  cache->enabled     = 0;
+  cache->complete    = 0;
+}
+
+static void _tsdb_res_cache_release(tsdb_res_cache_t *cache)
+{
+  _tsdb_res_cache_reset(cache);
+  TOD_SAFE_FREE(cache->blocks);
+  cache->cap = 0;
+  TOD_SAFE_FREE(cache->load);
+  cache->load_cap = 0;
+  TOD_SAFE_FREE(cache->cols);
+  cache->cols_cap = 0;
+}
+
+static int _tsdb_res_cache_keep_load(tsdb_res_cache_t *cache, size_t bytes)
+{
+  if (bytes <= cache->load_cap) return 0;
+  size_t cap = (bytes + 4095) / 4096 * 4096;
+  char *load = (char*)realloc(cache->load, cap);
+  if (!load) return -1;
+  cache->load     = load;
+  cache->load_cap = cap;
+  return 0;
+}
+
+// NOTE: per column: [uint64_t data bytes][nulls][offsets, variable-length only][data], each 8-byte aligned
+static SQLRETURN _tsdb_stmt_cache_install(tsdb_stmt_t *stmt, size_t i_block)
+{
+  tsdb_res_t           *res          = &stmt->res;
+  tsdb_rows_block_t    *rows_block   = &res->rows_block;
+  tsdb_res_cache_t     *cache        = &res->cache;
+  tsdb_cached_block_t  *block        = cache->blocks + i_block;
+  size_t                nr_cols      = res->fields.nr;
+
+  const char *p = block->buf;
+  if (!p) {
+    if (cache->loaded != i_block + 1) {
+      if (_tsdb_res_cache_keep_load(cache, block->bytes)) {
+        stmt_oom(stmt->owner);
+        return SQL_ERROR;
+      }
+      cache->loaded = 0;
+      if (tod_fseeki64(cache->spill, block->spilled_at, SEEK_SET) ||
+          fread(cache->load, 1, block->bytes, cache->spill) != block->bytes)
+      {
+        stmt_append_err_format(stmt->owner, "HY000", errno, "General error:reading back cached block failed:[%d]%s", errno, strerror(errno));
+        return SQL_ERROR;
+      }
+      cache->loaded = i_block + 1;
+    }
+    p = cache->load;
+  }
+
+  if (nr_cols > cache->cols_cap) {
+    size_t cap = (nr_cols + 15) / 16 * 16;
+    void **cols = (void**)realloc(cache->cols, cap * sizeof(*cols));
+    if (!cols) {
+      stmt_oom(stmt->owner);
+      return SQL_ERROR;
+    }
+    cache->cols     = cols;
+    cache->cols_cap = cap;
+  }
+
+  _tsdb_rows_block_reset(rows_block);
+  rows_block->nr = block->nr;
+
+  for (size_t i=0; i<nr_cols; ++i) {
+    tsdb_rows_block_col_t *col = _tsdb_rows_block_keep_col(rows_block, (int)i);
+    if (!col) {
+      rows_block->nr = 0;
+      stmt_oom(stmt->owner);
+      return SQL_ERROR;
+    }
+    uint64_t n = *(const uint64_t*)p;
+    p += sizeof(uint64_t);
+    memcpy(col->nulls, p, block->nr * sizeof(bool));
+    p += (block->nr * sizeof(bool) + 7) / 8 * 8;
+    if (_tsdb_data_type_is_var(res->fields.fields[i].type)) {
+      col->offsets = (const int*)p;
+      p += (block->nr * sizeof(int) + 7) / 8 * 8;
+    }
+    cache->cols[i] = (void*)p;
+    p += (n + 7) / 8 * 8;
+    col->nulls_ready   = 1;
+    col->offsets_ready = 1;
+  }
+
+  rows_block->rows = cache->cols;
+  rows_block->pos  = 0;
+  cache->current   = i_block;
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _tsdb_stmt_cache_block(tsdb_stmt_t *stmt)
+{
+  tsdb_res_t           *res          = &stmt->res;
+  tsdb_rows_block_t    *rows_block   = &res->rows_block;
+  tsdb_res_cache_t     *cache        = &res->cache;
+  size_t                nr_cols      = res->fields.nr;
+  size_t                nr_rows      = rows_block->nr;
+
+  if (cache->nr == cache->cap) {
+    size_t cap = (cache->cap + 1 + 15) / 16 * 16;
+    tsdb_cached_block_t *blocks = (tsdb_cached_block_t*)realloc(cache->blocks, cap * sizeof(*blocks));
+    if (!blocks) goto oom;
+    cache->blocks = blocks;
+    cache->cap    = cap;
+  }
+
+  if (nr_cols > cache->cols_cap) {
+    size_t cap = (nr_cols + 15) / 16 * 16;
+    void **cols = (void**)realloc(cache->cols, cap * sizeof(*cols));
+    if (!cols) goto oom;
+    cache->cols     = cols;
+    cache->cols_cap = cap;
+  }
+
+  size_t bytes = 0;
+  for (size_t i=0; i<nr_cols; ++i) {
+    tsdb_rows_block_col_t *col = _tsdb_res_get_block_col(res, (int)i);
+    if (!col) goto oom;
+    size_t n = _tsdb_res_block_col_bytes(res, col, (int)i);
+    cache->cols[i] = (void*)(uintptr_t)n;
+    bytes += sizeof(uint64_t) + (nr_rows * sizeof(bool) + 7) / 8 * 8 + (n + 7) / 8 * 8;
+    if (col->offsets) bytes += (nr_rows * sizeof(int) + 7) / 8 * 8;
+  }
+
+  int spill = cache->mem_bytes + bytes > cache->mem_limit;
+  char *buf = NULL;
+  if (spill) {
+    if (_tsdb_res_cache_keep_load(cache, bytes)) goto oom;
+    cache->loaded = 0;
+    buf = cache->load;
+  } else {
+    buf = (char*)malloc(bytes);
+    if (!buf) goto oom;
+  }
+
+  char *p = buf;
+  for (size_t i=0; i<nr_cols; ++i) {
+    tsdb_rows_block_col_t *col = rows_block->cols + i;
+    size_t n = (size_t)(uintptr_t)cache->cols[i];
+    *(uint64_t*)p = n;
+    p += sizeof(uint64_t);
+    memcpy(p, col->nulls, nr_rows * sizeof(bool));
+    p += (nr_rows * sizeof(bool) + 7) / 8 * 8;
+    if (col->offsets) {
+      memcpy(p, col->offsets, nr_rows * sizeof(int));
+      p += (nr_rows * sizeof(int) + 7) / 8 * 8;
+    }
+    if (n) memcpy(p, rows_block->rows[i], n);
+    p += (n + 7) / 8 * 8;
+  }
+
+  tsdb_cached_block_t *block = cache->blocks + cache->nr;
+  block->i_row      = cache->nr_rows;
+  block->nr         = nr_rows;
+  block->bytes      = bytes;
+  block->buf        = spill ? NULL : buf;
+  block->spilled_at = 0;
+
+  if (spill) {
+    if (!cache->spill) {
+      cache->spill = tmpfile();
+      if (!cache->spill) {
+        stmt_append_err_format(stmt->owner, "HY000", errno, "General error:creating spill file for static cursor failed:[%d]%s", errno, strerror(errno));
+        return SQL_ERROR;
+      }
+    }
+    if (tod_fseeki64(cache->spill, cache->spill_bytes, SEEK_SET) ||
+        fwrite(buf, 1, bytes, cache->spill) != bytes)
+    {
+      stmt_append_err_format(stmt->owner, "HY000", errno, "General error:spilling cached block failed:[%d]%s", errno, strerror(errno));
+      return SQL_ERROR;
+    }
+    block->spilled_at   = cache->spill_bytes;
+    cache->spill_bytes += bytes;
+    cache->loaded       = cache->nr + 1;
+  } else {
+    cache->mem_bytes += bytes;
+  }
+
+  cache->nr      += 1;
+  cache->nr_rows += nr_rows;
+
+  return _tsdb_stmt_cache_install(stmt, cache->nr - 1);
+
+oom:
+  stmt_oom(stmt->owner);
+  return SQL_ERROR;
 }
 
 void tsdb_res_reset(tsdb_res_t *res)
 {
   if (!res) return;
+  // NOTE: taosc still owns an in-flight fetch, which must land before the result could be freed
+  if (res->prefetch.pending) _tsdb_res_prefetch_wait(res);
   _tsdb_rows_block_reset(&res->rows_block);
+  _tsdb_res_cache_reset(&res->cache);
   _tsdb_fields_reset(&res->fields);
   if (res->res) {
     if (res->res_is_from_taos_query) {
@@ -306,6 +829,8 @@ void tsdb_res_release(tsdb_res_t *res)
 
   _tsdb_rows_block_release(&res->rows_block);
   _tsdb_fields_release(&res->fields);
+  _tsdb_prefetch_release(&res->prefetch);
+  _tsdb_res_cache_release(&res->cache);
 }
 
 static int _tsdb_binds_keep(tsdb_binds_t *tsdb_binds, int nr_params)
@@ -356,6 +881,11 @@ static SQLRETURN _stmt_post_query(tsdb_stmt_t *stmt)
       fields->nr = CALL_taos_field_count(res->res);
       if (fields->nr > 0) {
         fields->fields = CALL_taos_fetch_fields(res->res);
+        if (stmt->owner->cursor_type == SQL_CURSOR_STATIC) {
+          conn_cfg_t *cfg = &stmt->owner->conn->cfg;
+          res->cache.enabled   = 1;
+          res->cache.mem_limit = (size_t)(cfg->cursor_cache_size ? cfg->cursor_cache_size : TSDB_CURSOR_CACHE_SIZE_DEFAULT) * 1024 * 1024;
+        }
       }
     } else {
       res->affected_row_count = CALL_taos_stmt_affected_rows_once(stmt->stmt);
@@ -737,6 +1267,173 @@ static SQLRETURN _tsdb_stmt_get_taos_tags_cols_for_insert(tsdb_stmt_t *stmt)
   return sr;
 }
 
+static void _tsdb_prepared_free(tsdb_prepared_t *prepared)
+{
+  if (prepared->stmt) {
+    if (prepared->tag_fields) CALL_taos_stmt_reclaim_fields(prepared->stmt, prepared->tag_fields);
+    if (prepared->col_fields) CALL_taos_stmt_reclaim_fields(prepared->stmt, prepared->col_fields);
+    int r = CALL_taos_stmt_close(prepared->stmt);
+    OA_NIY(r == 0);
+  }
+  TOD_SAFE_FREE(prepared->db);
+  TOD_SAFE_FREE(prepared->sql);
+  free(prepared);
+}
+
+int tsdb_prepared_cache_init(tsdb_prepared_cache_t *cache)
+{
+  INIT_TOD_LIST_HEAD(&cache->prepareds);
+  cache->nr     = 0;
+  cache->hits   = 0;
+  cache->misses = 0;
+
+  return pthread_mutex_init(&cache->mutex, NULL);
+}
+
+void tsdb_prepared_cache_clear(tsdb_prepared_cache_t *cache)
+{
+  tsdb_prepared_t *p, *n;
+
+  pthread_mutex_lock(&cache->mutex);
+  tod_list_for_each_entry_safe(p, n, &cache->prepareds, tsdb_prepared_t, node) {
+    tod_list_del(&p->node);
+    _tsdb_prepared_free(p);
+  }
+  cache->nr = 0;
+  pthread_mutex_unlock(&cache->mutex);
+}
+
+void tsdb_prepared_cache_release(tsdb_prepared_cache_t *cache)
+{
+  tsdb_prepared_cache_clear(cache);
+  pthread_mutex_destroy(&cache->mutex);
+}
+
+static void _tsdb_stmt_get_current_db(tsdb_stmt_t *stmt, char *db, size_t len)
+{
+  ds_err_t ds_err;
+  ds_err.err = 0;
+  ds_err.str[0] = '\0';
+
+  db[0] = '\0';
+  if (ds_conn_get_current_db(&stmt->owner->conn->ds_conn, db, len, &ds_err)) db[0] = '\0';
+}
+
+static void _tsdb_stmt_checkout_prepared(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_tsdb, const char *db)
+{
+  conn_t *conn = stmt->owner->conn;
+  tsdb_prepared_cache_t *cache = &conn->prepared_cache;
+
+  if (!conn->cfg.stmt_cache) return;
+
+  // NOTE: counted here rather than in _tsdb_stmt_take_prepared, thus non-inserts, which are never cached, are no misses
+  pthread_mutex_lock(&cache->mutex);
+  ++cache->misses;
+  pthread_mutex_unlock(&cache->mutex);
+
+  // NOTE: keyed now, since current_sql would be overwritten by the time the statement is parked
+  tsdb_prepared_t *prepared = (tsdb_prepared_t*)calloc(1, sizeof(*prepared));
+  if (!prepared) return;
+  prepared->db      = strdup(db);
+  prepared->sql     = strndup(sqlc_tsdb->tsdb, sqlc_tsdb->tsdb_bytes);
+  prepared->sql_len = sqlc_tsdb->tsdb_bytes;
+  if (!prepared->db || !prepared->sql) {
+    _tsdb_prepared_free(prepared);
+    return;
+  }
+  stmt->checkout = prepared;
+}
+
+static int _tsdb_stmt_take_prepared(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_tsdb, char *db, size_t db_len)
+{
+  conn_t *conn = stmt->owner->conn;
+  tsdb_prepared_cache_t *cache = &conn->prepared_cache;
+
+  db[0] = '\0';
+  if (!conn->cfg.stmt_cache) return 0;
+
+  _tsdb_stmt_get_current_db(stmt, db, db_len);
+
+  tsdb_prepared_t *prepared = NULL;
+  tsdb_prepared_t *p;
+
+  pthread_mutex_lock(&cache->mutex);
+  tod_list_for_each_entry(p, &cache->prepareds, tsdb_prepared_t, node) {
+    if (p->sql_len != sqlc_tsdb->tsdb_bytes) continue;
+    if (memcmp(p->sql, sqlc_tsdb->tsdb, p->sql_len)) continue;
+    if (strcmp(p->db, db)) continue;
+    tod_list_del(&p->node);
+    --cache->nr;
+    prepared = p;
+    break;
+  }
+  if (prepared) ++cache->hits;
+  pthread_mutex_unlock(&cache->mutex);
+
+  // NOTE: checked out by _tsdb_stmt_checkout_prepared once known to be an insert
+  if (!prepared) return 0;
+
+  OD("reusing prepared statement from connection cache:[%.*s]", (int)prepared->sql_len, prepared->sql);
+
+  stmt->stmt                      = prepared->stmt;
+  stmt->params.tag_fields         = prepared->tag_fields;
+  stmt->params.nr_tag_fields      = prepared->nr_tag_fields;
+  stmt->params.col_fields         = prepared->col_fields;
+  stmt->params.nr_col_fields      = prepared->nr_col_fields;
+  stmt->params.subtbl_required    = prepared->subtbl_required;
+  stmt->is_insert_stmt            = 1;
+  stmt->prepared                  = 1;
+
+  prepared->stmt       = NULL;
+  prepared->tag_fields = NULL;
+  prepared->col_fields = NULL;
+  stmt->checkout       = prepared;
+
+  return 1;
+}
+
+static void _tsdb_stmt_park_prepared(tsdb_stmt_t *stmt)
+{
+  tsdb_prepared_t *prepared = stmt->checkout;
+  if (!prepared) return;
+  stmt->checkout = NULL;
+
+  conn_t *conn = stmt->owner->conn;
+  tsdb_prepared_cache_t *cache = &conn->prepared_cache;
+
+  // NOTE: only inserts, whose TAOS_STMT holds no result set and is rebound from scratch on next execute
+  if (!stmt->stmt || !stmt->prepared || !stmt->is_insert_stmt || !stmt->idle) {
+    _tsdb_prepared_free(prepared);
+    return;
+  }
+
+  prepared->stmt            = stmt->stmt;
+  prepared->tag_fields      = stmt->params.tag_fields;
+  prepared->nr_tag_fields   = stmt->params.nr_tag_fields;
+  prepared->col_fields      = stmt->params.col_fields;
+  prepared->nr_col_fields   = stmt->params.nr_col_fields;
+  prepared->subtbl_required = stmt->params.subtbl_required;
+
+  stmt->stmt                  = NULL;
+  stmt->params.tag_fields     = NULL;
+  stmt->params.nr_tag_fields  = 0;
+  stmt->params.col_fields     = NULL;
+  stmt->params.nr_col_fields  = 0;
+  stmt->prepared              = 0;
+  stmt->idle                  = 0;
+
+  pthread_mutex_lock(&cache->mutex);
+  tod_list_add(&prepared->node, &cache->prepareds);
+  ++cache->nr;
+  while (cache->nr > conn->cfg.stmt_cache) {
+    tsdb_prepared_t *lru = tod_list_last_entry(&cache->prepareds, tsdb_prepared_t, node);
+    tod_list_del(&lru->node);
+    --cache->nr;
+    _tsdb_prepared_free(lru);
+  }
+  pthread_mutex_unlock(&cache->mutex);
+}
+
 static SQLRETURN _tsdb_stmt_prepare(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_tsdb)
 {
   int r = 0;
@@ -776,6 +1473,9 @@ static SQLRETURN _tsdb_stmt_prepare(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_t
     }
   } else {
 #endif                       /* ] */
+    char db[193];
+    if (_tsdb_stmt_take_prepared(stmt, sqlc_tsdb, db, sizeof(db))) return _tsdb_stmt_post_check(stmt);
+
     stmt->stmt = CALL_taos_stmt_init(stmt->owner->conn->ds_conn.taos);
     if (!stmt->stmt) {
       stmt_append_err_format(stmt->owner, "HY000", CALL_taos_errno(NULL), "General error:[taosc]%s", CALL_taos_errstr(NULL));
@@ -797,6 +1497,9 @@ static SQLRETURN _tsdb_stmt_prepare(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_t
 
       return SQL_ERROR;
     }
+
+    // NOTE: only inserts are ever parked, see _tsdb_stmt_park_prepared
+    if (isInsert) _tsdb_stmt_checkout_prepared(stmt, sqlc_tsdb, db);
 #ifdef HAVE_TAOSWS           /* [ */
   }
 #endif                       /* ] */
@@ -825,17 +1528,13 @@ static SQLRETURN _prepare(stmt_base_t *base, const sqlc_tsdb_t *sqlc_tsdb)
 
   stmt->params.qms = sqlc_tsdb->qms;
 
-  return _tsdb_stmt_prepare(stmt, sqlc_tsdb);
+  SQLRETURN sr = _tsdb_stmt_prepare(stmt, sqlc_tsdb);
+  if (sr == SQL_SUCCESS) stmt->idle = 1;
+  return sr;
 }
 
-static SQLRETURN _execute(stmt_base_t *base)
+static SQLRETURN _tsdb_stmt_check_params_bound(tsdb_stmt_t *stmt)
 {
-  int r = 0;
-
-  tsdb_stmt_t *stmt = (tsdb_stmt_t*)base;
-  tsdb_res_t          *res         = &stmt->res;
-  tsdb_res_reset(res);
-
   descriptor_t *APD = stmt_APD(stmt->owner);
   desc_header_t *APD_header = &APD->header;
 
@@ -861,6 +1560,52 @@ static SQLRETURN _execute(stmt_base_t *base)
     OW("bind more parameters (#%d) than required (#%d) by sql-statement", APD_header->DESC_COUNT, n);
   }
 
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _tsdb_stmt_use_result(tsdb_stmt_t *stmt, int r)
+{
+  tsdb_res_t          *res         = &stmt->res;
+
+  if (r) {
+    stmt_append_err_format(stmt->owner, "HY000", r, "General error:[taosc]%s", CALL_taos_stmt_errstr(stmt->stmt));
+    // NOTE: taosc drops the bound table on failure
+    stmt->params.memo_valid = 0;
+    return SQL_ERROR;
+  }
+
+  res->res = CALL_taos_stmt_use_result(stmt->stmt);
+  res->res_is_from_taos_query = 0;
+
+  int e = CALL_taos_errno(res->res);
+  if (e) {
+    const char *estr = CALL_taos_errstr(res->res);
+    stmt_append_err_format(stmt->owner, "HY000", e, "General error:[taosc]%s", estr);
+    stmt->params.memo_valid = 0;
+    return SQL_ERROR;
+  }
+
+  stmt->idle = 1;
+  stmt->params.memo_valid = 1;
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _execute(stmt_base_t *base)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+  int r = 0;
+
+  tsdb_stmt_t *stmt = (tsdb_stmt_t*)base;
+  tsdb_res_t          *res         = &stmt->res;
+  tsdb_res_reset(res);
+
+  descriptor_t *APD = stmt_APD(stmt->owner);
+  desc_header_t *APD_header = &APD->header;
+
+  sr = _tsdb_stmt_check_params_bound(stmt);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
   if (stmt->params.qms == 0) {
     if (APD_header->DESC_COUNT > 0) {
       stmt_append_err(stmt->owner, "HY000", 0,
@@ -891,25 +1636,221 @@ static SQLRETURN _execute(stmt_base_t *base)
   } else {
 #endif                       /* ] */
     r = CALL_taos_stmt_execute(stmt->stmt);
-    if (r) {
-      stmt_append_err_format(stmt->owner, "HY000", r, "General error:[taosc]%s", CALL_taos_stmt_errstr(stmt->stmt));
+    sr = _tsdb_stmt_use_result(stmt, r);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+#ifdef HAVE_TAOSWS           /* [ */
+  }
+#endif                       /* ] */
+
+  return _stmt_post_query(stmt);
+}
+
+static void* _tsdb_stmt_pipeline_routine(void *arg)
+{
+  tsdb_pipeline_t *pipeline = (tsdb_pipeline_t*)arg;
+
+  pipeline->r = CALL_taos_stmt_execute(pipeline->stmt);
+
+  return NULL;
+}
+
+static void _tsdb_pipeline_join(tsdb_pipeline_t *pipeline)
+{
+  if (!pipeline->running) return;
+
+  pthread_join(pipeline->worker, NULL);
+  pipeline->running = 0;
+}
+
+static SQLRETURN _tsdb_stmt_executed(tsdb_stmt_t *stmt, int r)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  sr = _tsdb_stmt_use_result(stmt, r);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  return _stmt_post_query(stmt);
+}
+
+SQLRETURN tsdb_stmt_execute_start(tsdb_stmt_t *stmt)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+  tsdb_pipeline_t *pipeline = &stmt->pipeline;
+
+  OA_ILE(!pipeline->running);
+  OA_ILE(stmt->params.qms > 0);
+
+  tsdb_res_reset(&stmt->res);
+
+  sr = _tsdb_stmt_check_params_bound(stmt);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  pipeline->stmt = stmt->stmt;
+  pipeline->r    = 0;
+  if (pthread_create(&pipeline->worker, NULL, _tsdb_stmt_pipeline_routine, pipeline)) {
+    // NOTE: no worker available, execute in place
+    return _tsdb_stmt_executed(stmt, CALL_taos_stmt_execute(stmt->stmt));
+  }
+
+  pipeline->running = 1;
+
+  return SQL_SUCCESS;
+}
+
+SQLRETURN tsdb_stmt_execute_wait(tsdb_stmt_t *stmt)
+{
+  tsdb_pipeline_t *pipeline = &stmt->pipeline;
+
+  if (!pipeline->running) return SQL_SUCCESS;
+
+  _tsdb_pipeline_join(pipeline);
+
+  return _tsdb_stmt_executed(stmt, pipeline->r);
+}
+
+static void _tsdb_stmt_shards_close(tsdb_stmt_t *stmt)
+{
+  for (size_t i = 0; i < stmt->nr_shards; ++i) {
+    tsdb_shard_t *shard = stmt->shards + i;
+    _tsdb_pipeline_join(&shard->pipeline);
+    if (shard->stmt) {
+      int r = CALL_taos_stmt_close(shard->stmt);
+      OA_NIY(r == 0);
+      shard->stmt = NULL;
+    }
+  }
+  TOD_SAFE_FREE(stmt->shards);
+  stmt->nr_shards = 0;
+}
+
+SQLRETURN tsdb_stmt_shards_prepare(tsdb_stmt_t *stmt, size_t nr_shards)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+  int r = 0;
+
+  OA_ILE(stmt->params.qms > 0);
+  OA_ILE(nr_shards > 1);
+
+  tsdb_res_reset(&stmt->res);
+
+  sr = _tsdb_stmt_check_params_bound(stmt);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  if (stmt->nr_shards == nr_shards) return SQL_SUCCESS;
+
+  _tsdb_stmt_shards_close(stmt);
+
+  stmt->shards = (tsdb_shard_t*)calloc(nr_shards, sizeof(*stmt->shards));
+  if (!stmt->shards) {
+    stmt_oom(stmt->owner);
+    return SQL_ERROR;
+  }
+  stmt->nr_shards = nr_shards;
+
+  for (size_t i = 0; i < nr_shards; ++i) {
+    tsdb_shard_t *shard = stmt->shards + i;
+
+    TAOS *taos = conn_get_shard(stmt->owner->conn, i);
+    if (!taos) {
+      stmt_append_err_format(stmt->owner, "HY000", CALL_taos_errno(NULL), "General error:[taosc]connecting shard #%zd failed:%s", i + 1, CALL_taos_errstr(NULL));
+      _tsdb_stmt_shards_close(stmt);
       return SQL_ERROR;
     }
 
-    res->res = CALL_taos_stmt_use_result(stmt->stmt);
-    res->res_is_from_taos_query = 0;
+    shard->stmt = CALL_taos_stmt_init(taos);
+    if (!shard->stmt) {
+      stmt_append_err_format(stmt->owner, "HY000", CALL_taos_errno(NULL), "General error:[taosc]%s", CALL_taos_errstr(NULL));
+      _tsdb_stmt_shards_close(stmt);
+      return SQL_ERROR;
+    }
 
-    int e = CALL_taos_errno(res->res);
-    if (e) {
-      const char *estr = CALL_taos_errstr(res->res);
-      stmt_append_err_format(stmt->owner, "HY000", e, "General error:[taosc]%s", estr);
+    r = CALL_taos_stmt_prepare(shard->stmt, stmt->current_sql->tsdb, (unsigned long)stmt->current_sql->tsdb_bytes);
+    if (r) {
+      stmt_append_err_format(stmt->owner, "HY000", r, "General error:[taosc]%s", CALL_taos_stmt_errstr(shard->stmt));
+      _tsdb_stmt_shards_close(stmt);
       return SQL_ERROR;
     }
-#ifdef HAVE_TAOSWS           /* [ */
   }
-#endif                       /* ] */
 
-  return _stmt_post_query(stmt);
+  return SQL_SUCCESS;
+}
+
+SQLRETURN tsdb_stmt_shard_bind(tsdb_stmt_t *stmt, size_t i_shard, const char *subtbl, TAOS_MULTI_BIND *tags, TAOS_MULTI_BIND *cols)
+{
+  int r = 0;
+  tsdb_shard_t *shard = stmt->shards + i_shard;
+
+  OA_ILE(i_shard < stmt->nr_shards);
+  OA_ILE(!shard->pipeline.running);
+
+  r = CALL_taos_stmt_set_tbname(shard->stmt, subtbl);
+  if (r) goto fail;
+
+  if (stmt->params.nr_tag_fields) {
+    r = CALL_taos_stmt_set_tags(shard->stmt, tags);
+    if (r) goto fail;
+  }
+
+  r = CALL_taos_stmt_bind_param_batch(shard->stmt, cols);
+  if (r) goto fail;
+
+  r = CALL_taos_stmt_add_batch(shard->stmt);
+  if (r) goto fail;
+
+  return SQL_SUCCESS;
+
+fail:
+  stmt_append_err_format(stmt->owner, "HY000", r, "General error:[taosc]shard #%zd:%s", i_shard + 1, CALL_taos_stmt_errstr(shard->stmt));
+  return SQL_ERROR;
+}
+
+static SQLRETURN _tsdb_stmt_shard_executed(tsdb_stmt_t *stmt, tsdb_shard_t *shard)
+{
+  int r = shard->pipeline.r;
+
+  if (r) {
+    stmt_append_err_format(stmt->owner, "HY000", r, "General error:[taosc]shard #%zd:%s", (size_t)(shard - stmt->shards) + 1, CALL_taos_stmt_errstr(shard->stmt));
+    return SQL_ERROR;
+  }
+
+  stmt->res.affected_row_count += CALL_taos_stmt_affected_rows_once(shard->stmt);
+
+  return SQL_SUCCESS;
+}
+
+SQLRETURN tsdb_stmt_shard_execute_start(tsdb_stmt_t *stmt, size_t i_shard)
+{
+  tsdb_shard_t *shard = stmt->shards + i_shard;
+  tsdb_pipeline_t *pipeline = &shard->pipeline;
+
+  OA_ILE(i_shard < stmt->nr_shards);
+  OA_ILE(!pipeline->running);
+
+  pipeline->stmt = shard->stmt;
+  pipeline->r    = 0;
+  if (pthread_create(&pipeline->worker, NULL, _tsdb_stmt_pipeline_routine, pipeline)) {
+    // NOTE: no worker available, execute in place
+    pipeline->r = CALL_taos_stmt_execute(shard->stmt);
+    return _tsdb_stmt_shard_executed(stmt, shard);
+  }
+
+  pipeline->running = 1;
+
+  return SQL_SUCCESS;
+}
+
+SQLRETURN tsdb_stmt_shard_execute_wait(tsdb_stmt_t *stmt, size_t i_shard)
+{
+  tsdb_shard_t *shard = stmt->shards + i_shard;
+  tsdb_pipeline_t *pipeline = &shard->pipeline;
+
+  OA_ILE(i_shard < stmt->nr_shards);
+
+  if (!pipeline->running) return SQL_SUCCESS;
+
+  _tsdb_pipeline_join(pipeline);
+
+  return _tsdb_stmt_shard_executed(stmt, shard);
 }
 
 static SQLRETURN _get_col_fields(stmt_base_t *base, TAOS_FIELD **fields, size_t *nr)
@@ -923,10 +1864,70 @@ static SQLRETURN _get_col_fields(stmt_base_t *base, TAOS_FIELD **fields, size_t
   return SQL_SUCCESS;
 }
 
+static SQLRETURN _tsdb_stmt_prefetch_rows_block(tsdb_stmt_t *stmt)
+{
+  tsdb_res_t           *res          = &stmt->res;
+  tsdb_rows_block_t    *rows_block   = &res->rows_block;
+  tsdb_prefetch_t      *prefetch     = &res->prefetch;
+
+  if (!prefetch->inited) {
+    if (pthread_mutex_init(&prefetch->mutex, NULL)) {
+      stmt_append_err(stmt->owner, "HY000", 0, "General error:initializing mutex for prefetching failed");
+      return SQL_ERROR;
+    }
+    if (pthread_cond_init(&prefetch->cond, NULL)) {
+      pthread_mutex_destroy(&prefetch->mutex);
+      stmt_append_err(stmt->owner, "HY000", 0, "General error:initializing condition variable for prefetching failed");
+      return SQL_ERROR;
+    }
+    prefetch->inited = 1;
+  }
+
+  if (!prefetch->pending) _tsdb_res_prefetch_issue(res);
+
+  int nr_rows = _tsdb_res_prefetch_wait(res);
+  if (nr_rows < 0) {
+    stmt_append_err_format(stmt->owner, "HY000", nr_rows, "General error:[taosc]%s", CALL_taos_errstr(res->res));
+    return SQL_ERROR;
+  }
+  if (nr_rows == 0) {
+    res->cache.complete = 1;
+    return SQL_NO_DATA;
+  }
+
+  TAOS_ROW *rows = CALL_taos_result_block(res->res);
+  if (!rows) {
+    stmt_append_err_format(stmt->owner, "HY000", 0, "General error:[taosc]%s", CALL_taos_errstr(res->res));
+    return SQL_ERROR;
+  }
+  rows_block->rows   = *rows;
+  rows_block->nr     = nr_rows;
+  rows_block->pos    = 0;
+
+  if (res->cache.enabled) {
+    // NOTE: the cached copy is driver-owned as well, no need to snapshot
+    SQLRETURN sr = _tsdb_stmt_cache_block(stmt);
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+  } else if (_tsdb_res_snapshot_block(res)) {
+    stmt_oom(stmt->owner);
+    return SQL_ERROR;
+  }
+
+  _tsdb_res_prefetch_issue(res);
+
+  return SQL_SUCCESS;
+}
+
 static SQLRETURN _tsdb_stmt_fetch_rows_block(tsdb_stmt_t *stmt)
 {
   tsdb_res_t           *res          = &stmt->res;
   tsdb_rows_block_t    *rows_block   = &res->rows_block;
+  tsdb_res_cache_t     *cache        = &res->cache;
+
+  if (cache->enabled) {
+    if (cache->nr && cache->current + 1 < cache->nr) return _tsdb_stmt_cache_install(stmt, cache->current + 1);
+    if (cache->complete) return SQL_NO_DATA;
+  }
 
   _tsdb_rows_block_reset(rows_block);
 
@@ -946,6 +1947,7 @@ static SQLRETURN _tsdb_stmt_fetch_rows_block(tsdb_stmt_t *stmt)
     rows_block->pos    = 0;
   } else {
 #endif                       /* ] */
+    if (stmt->owner->conn->cfg.prefetch) return _tsdb_stmt_prefetch_rows_block(stmt);
 #ifdef USE_TICK_TO_DEBUG                 /* { */
     int r = stmt_enter_fetch_block(stmt->owner);
     OA_ILE(r == 0);
@@ -955,10 +1957,14 @@ static SQLRETURN _tsdb_stmt_fetch_rows_block(tsdb_stmt_t *stmt)
 #ifdef USE_TICK_TO_DEBUG                 /* { */
     stmt_leave_fetch_block(stmt->owner);
 #endif                                   /* } */
-    if (nr_rows == 0) return SQL_NO_DATA;
+    if (nr_rows == 0) {
+      cache->complete = 1;
+      return SQL_NO_DATA;
+    }
     rows_block->rows   = rows;
     rows_block->nr     = nr_rows;
     rows_block->pos    = 0;
+    if (cache->enabled) return _tsdb_stmt_cache_block(stmt);
 #ifdef HAVE_TAOSWS           /* [ */
   }
 #endif                       /* ] */
@@ -991,6 +1997,122 @@ again:
   return SQL_SUCCESS;
 }
 
+static SQLRETURN _fetch_rows_slice(stmt_base_t *base, size_t nr_max, tsdb_rows_slice_t *slice)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  tsdb_stmt_t *stmt = (tsdb_stmt_t*)base;
+  tsdb_res_t           *res          = &stmt->res;
+  tsdb_rows_block_t    *rows_block   = &res->rows_block;
+
+  if (res->eof) return SQL_NO_DATA;
+
+  if (rows_block->pos >= rows_block->nr) {
+    sr = _tsdb_stmt_fetch_rows_block(stmt);
+    if (sr == SQL_NO_DATA) {
+      res->eof = 1;
+      return SQL_NO_DATA;
+    }
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+  }
+
+  size_t nr = rows_block->nr - rows_block->pos;
+  if (nr > nr_max) nr = nr_max;
+
+  slice->res        = res;
+  slice->i_row      = rows_block->pos;
+  slice->nr         = nr;
+
+  // NOTE: pos refers to the last row of the slice, thus SQLGetData still works as expected
+  rows_block->pos += nr;
+  return SQL_SUCCESS;
+}
+
+void tsdb_rows_slice_seek(tsdb_rows_slice_t *slice, size_t i)
+{
+  // NOTE: i is 0-based, within the slice, pos is 1-based, within the block
+  slice->res->rows_block.pos = slice->i_row + i + 1;
+}
+
+static SQLRETURN _tsdb_stmt_cache_more(tsdb_stmt_t *stmt)
+{
+  tsdb_res_cache_t     *cache        = &stmt->res.cache;
+
+  if (cache->complete) return SQL_NO_DATA;
+  // NOTE: pretend the last cached block is installed, thus the next one comes from the server
+  if (cache->nr) cache->current = cache->nr - 1;
+  return _tsdb_stmt_fetch_rows_block(stmt);
+}
+
+static SQLRETURN _seek_row(stmt_base_t *base, size_t i_row)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  tsdb_stmt_t *stmt = (tsdb_stmt_t*)base;
+  tsdb_res_t           *res          = &stmt->res;
+  tsdb_rows_block_t    *rows_block   = &res->rows_block;
+  tsdb_res_cache_t     *cache        = &res->cache;
+
+  if (!cache->enabled) {
+    stmt_append_err(stmt->owner, "HY106", 0, "Fetch type out of range:result set is not cached, cursor is forward-only");
+    return SQL_ERROR;
+  }
+
+  while (i_row >= cache->nr_rows) {
+    sr = _tsdb_stmt_cache_more(stmt);
+    if (sr == SQL_NO_DATA) break;
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+  }
+
+  if (i_row >= cache->nr_rows) {
+    // NOTE: after the end, position at the end of the last block
+    if (cache->nr) {
+      sr = _tsdb_stmt_cache_install(stmt, cache->nr - 1);
+      if (sr != SQL_SUCCESS) return SQL_ERROR;
+      rows_block->pos = rows_block->nr;
+    }
+    res->eof = 1;
+    return SQL_NO_DATA;
+  }
+
+  size_t lo = 0, hi = cache->nr;
+  while (hi - lo > 1) {
+    size_t mid = (lo + hi) / 2;
+    if (cache->blocks[mid].i_row <= i_row) lo = mid;
+    else                                   hi = mid;
+  }
+
+  sr = _tsdb_stmt_cache_install(stmt, lo);
+  if (sr != SQL_SUCCESS) return SQL_ERROR;
+
+  rows_block->pos = i_row - cache->blocks[lo].i_row;
+  res->eof        = 0;
+
+  return SQL_SUCCESS;
+}
+
+static SQLRETURN _get_num_rows(stmt_base_t *base, size_t *nr_rows)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  tsdb_stmt_t *stmt = (tsdb_stmt_t*)base;
+  tsdb_res_cache_t     *cache        = &stmt->res.cache;
+
+  if (!cache->enabled) {
+    stmt_append_err(stmt->owner, "HY106", 0, "Fetch type out of range:result set is not cached, cursor is forward-only");
+    return SQL_ERROR;
+  }
+
+  while (!cache->complete) {
+    sr = _tsdb_stmt_cache_more(stmt);
+    if (sr == SQL_NO_DATA) break;
+    if (sr != SQL_SUCCESS) return SQL_ERROR;
+  }
+
+  *nr_rows = cache->nr_rows;
+  return SQL_SUCCESS;
+}
+
 static SQLRETURN _more_results(stmt_base_t *base)
 {
   (void)base;
@@ -1173,7 +2295,12 @@ static SQLRETURN _get_data(stmt_base_t *base, SQLUSMALLINT Col_or_Param_Num, tsd
     r = helper_get_tsdb_ws(result_precision, ws_field->name, col_type, col_data, col_len, i_row, i_col, tsdb, buf, sizeof(buf));
   } else {
 #endif                       /* ] */
-    r = helper_get_tsdb(res->res, 1, fields->fields, res->time_precision, rows, i_row, i_col, tsdb, buf, sizeof(buf));
+    tsdb_rows_block_col_t *col = _tsdb_res_get_block_col(res, i_col);
+    if (!col) {
+      stmt_oom(stmt->owner);
+      return SQL_ERROR;
+    }
+    r = helper_get_tsdb_in_block(fields->fields, res->time_precision, rows, col->offsets, col->nulls[i_row], i_row, i_col, tsdb, buf, sizeof(buf));
 #ifdef HAVE_TAOSWS           /* [ */
   }
 #endif                       /* ] */
@@ -1201,6 +2328,9 @@ void tsdb_stmt_init(tsdb_stmt_t *stmt, stmt_t *owner)
   base->row_count               = _row_count;
   base->get_num_cols            = _get_num_cols;
   base->get_data                = _get_data;
+  base->fetch_rows_slice        = _fetch_rows_slice;
+  base->seek_row                = _seek_row;
+  base->get_num_rows            = _get_num_rows;
 
   stmt->owner = owner;
   stmt->params.owner = stmt;
@@ -1209,11 +2339,13 @@ void tsdb_stmt_init(tsdb_stmt_t *stmt, stmt_t *owner)
 
 void tsdb_stmt_unprepare(tsdb_stmt_t *stmt)
 {
+  _tsdb_stmt_park_prepared(stmt);
   stmt->current_sql = NULL;
   _tsdb_params_reset(&stmt->params);
   stmt->prepared = 0;
   stmt->is_ext   = 0;
   stmt->is_insert_stmt = 0;
+  stmt->idle     = 0;
   _tsdb_binds_reset(&stmt->owner->tsdb_binds);
 }
 
@@ -1225,6 +2357,8 @@ static void _tsdb_stmt_close_result(tsdb_stmt_t *stmt)
 void tsdb_stmt_reset(tsdb_stmt_t *stmt)
 {
   if (!stmt) return;
+  _tsdb_pipeline_join(&stmt->pipeline);
+  _tsdb_stmt_shards_close(stmt);
   _tsdb_stmt_close_result(stmt);
   if (stmt->stmt) {
     int r = 0;
@@ -1246,6 +2380,7 @@ void tsdb_stmt_release(tsdb_stmt_t *stmt)
 {
   if (!stmt) return;
 
+  _tsdb_stmt_park_prepared(stmt);
   tsdb_stmt_reset(stmt);
 
   tsdb_res_release(&stmt->res);
@@ -1263,19 +2398,8 @@ SQLRETURN tsdb_stmt_query(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_tsdb)
   return _execute(&stmt->base);
 }
 
-SQLRETURN tsdb_stmt_rebind_subtbl(tsdb_stmt_t *stmt)
+SQLRETURN tsdb_stmt_set_tbname(tsdb_stmt_t *stmt)
 {
-  SQLRETURN sr = SQL_SUCCESS;
-
-  if (!stmt->params.subtbl_required) {
-    stmt_niy(stmt->owner);
-    return SQL_ERROR;
-  }
-
-  _tsdb_params_reset_tag_fields(&stmt->params);
-  _tsdb_params_reset_col_fields(&stmt->params);
-  _tsdb_params_reset_params(&stmt->params);
-
   int e = 0;
   const char *subtbl = stmt->params.subtbl;
   int r = 0;
@@ -1299,6 +2423,25 @@ SQLRETURN tsdb_stmt_rebind_subtbl(tsdb_stmt_t *stmt)
   }
 #endif                       /* ] */
 
+  return SQL_SUCCESS;
+}
+
+SQLRETURN tsdb_stmt_rebind_subtbl(tsdb_stmt_t *stmt)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  if (!stmt->params.subtbl_required) {
+    stmt_niy(stmt->owner);
+    return SQL_ERROR;
+  }
+
+  _tsdb_params_reset_tag_fields(&stmt->params);
+  _tsdb_params_reset_col_fields(&stmt->params);
+  _tsdb_params_reset_params(&stmt->params);
+
+  sr = tsdb_stmt_set_tbname(stmt);
+  if (sr == SQL_ERROR) return SQL_ERROR;
+
   sr = _tsdb_stmt_describe_tags(stmt);
   if (sr == SQL_ERROR) return SQL_ERROR;
 
@@ -39,6 +39,13 @@ iconv_t charset_conv_get(charset_conv_t *cnv) FA_HIDDEN;
 void charset_conv_mgr_release(charset_conv_mgr_t *mgr) FA_HIDDEN;
 charset_conv_t* charset_conv_mgr_get_charset_conv(charset_conv_mgr_t *mgr, const char *fromcode, const char *tocode) FA_HIDDEN;
 
+int charset_is_utf8(const char *charset) FA_HIDDEN;
+// NOTE: converts whole characters as many as `*outlen` allows, and advances `*in`/`*inlen`/`*out`/`*outlen` accordingly
+//       returns 0 if all converted, 1 if stopped since out of room, -1 if invalid utf-8 encountered
+int charset_utf8_to_utf16le(const char **in, size_t *inlen, char **out, size_t *outlen) FA_HIDDEN;
+// NOTE: number of bytes that the utf-8 input would take in UTF-16LE, -1 if invalid utf-8
+int charset_utf8_utf16le_bytes(const char *s, size_t n, size_t *bytes) FA_HIDDEN;
+
 size_t iconv_x(const char *file, int line, const char *func,
     iconv_t cd, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) FA_HIDDEN;
 
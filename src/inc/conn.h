@@ -31,11 +31,16 @@
 #include "utils.h"
 
 #include <sql.h>
+#include <taos.h>
 
 EXTERN_C_BEGIN
 
 void conn_cfg_release(conn_cfg_t *conn_cfg) FA_HIDDEN;
 
+// NOTE: see CONN_POOL, idle connections owned by env
+int conn_pool_init(conn_pool_t *pool) FA_HIDDEN;
+void conn_pool_release(conn_pool_t *pool) FA_HIDDEN;
+
 const custprod_item_t *conn_get_custprod_by_index(size_t index) FA_HIDDEN;
 
 const custprod_item_t *conn_get_custprod_by_name(const char *s, size_t n) FA_HIDDEN;
@@ -60,6 +65,9 @@ SQLRETURN conn_driver_connect(
 
 void conn_disconnect(conn_t *conn) FA_HIDDEN;
 
+// NOTE: native backend only, see PARALLEL_INSERT, NULL if connecting failed, check taos_errstr(NULL)
+TAOS* conn_get_shard(conn_t *conn, size_t i_shard) FA_HIDDEN;
+
 SQLRETURN conn_get_diag_rec(
     conn_t         *conn,
     SQLSMALLINT     RecNumber,
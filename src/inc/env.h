@@ -74,6 +74,13 @@ SQLRETURN env_end_tran(env_t *env, SQLSMALLINT CompletionType) FA_HIDDEN;
 
 SQLRETURN env_alloc_conn(env_t *env, SQLHANDLE *OutputHandle) FA_HIDDEN;
 
+// NOTE: see SQL_ATTR_QUERY_TIMEOUT, timer->fire(timer->arg) is called on the worker with timers unlocked,
+//       thus fire() may arm/disarm other timers, but must not disarm its own one, which would wait for itself
+int env_timer_arm(env_t *env, query_timer_t *timer, int64_t seconds) FA_HIDDEN;
+// NOTE: returns 1 if the timer has already fired, after which it's guaranteed not to fire anymore,
+//       if fire() is running at the moment, waits till it returns, thus `arg` can be released right after
+int env_timer_disarm(env_t *env, query_timer_t *timer) FA_HIDDEN;
+
 SQLRETURN env_get_diag_field(
     env_t          *env,
     SQLSMALLINT     RecNumber,
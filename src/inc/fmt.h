@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022-2023 freemine <freemine@yeah.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _fmt_h_
+#define _fmt_h_
+
+#include "macros.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+EXTERN_C_BEGIN
+
+// NOTE: all formatters below write plain ascii, null-terminated, into `s` which shall hold at least FMT_MAX + 1 bytes
+//       and return the number of characters written, null-terminator exclusive
+#define FMT_MAX            47
+
+size_t fmt_uint64(char *s, uint64_t v) FA_HIDDEN;
+size_t fmt_int64(char *s, int64_t v) FA_HIDDEN;
+size_t fmt_double(char *s, double v) FA_HIDDEN;
+size_t fmt_float(char *s, float v) FA_HIDDEN;
+// NOTE: `yyyy-mm-dd hh:mm:ss.fff`, with `w` digits of fraction
+size_t fmt_timestamp(char *s, const struct tm *tm, int32_t fraction, int w) FA_HIDDEN;
+
+// NOTE: widen `n` ascii characters in place into UTF-16LE, `s` shall hold at least (n + 1) * 2 bytes
+size_t fmt_widen_utf16le(char *s, size_t n) FA_HIDDEN;
+
+EXTERN_C_END
+
+#endif //  _fmt_h_
+
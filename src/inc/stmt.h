@@ -120,6 +120,9 @@ SQLRETURN stmt_set_attr(stmt_t *stmt, SQLINTEGER Attribute, SQLPOINTER ValuePtr,
 
 SQLRETURN stmt_free_stmt(stmt_t *stmt, SQLUSMALLINT Option) FA_HIDDEN;
 SQLRETURN stmt_close_cursor(stmt_t *stmt) FA_HIDDEN;
+// NOTE: might be called from another thread while stmt is executing or fetching
+SQLRETURN stmt_cancel(stmt_t *stmt) FA_HIDDEN;
+int stmt_is_cancelled(stmt_t *stmt) FA_HIDDEN;
 
 SQLRETURN stmt_tables(stmt_t *stmt,
     SQLCHAR       *CatalogName,
@@ -42,12 +42,28 @@ void tsdb_paramset_release(tsdb_paramset_t *paramset) FA_HIDDEN;
 void tsdb_binds_release(tsdb_binds_t *tsdb_binds) FA_HIDDEN;
 void tsdb_res_reset(tsdb_res_t *res) FA_HIDDEN;
 void tsdb_res_release(tsdb_res_t *res) FA_HIDDEN;
+const bool* tsdb_res_get_col_nulls(tsdb_res_t *res, int i_col) FA_HIDDEN;
+void tsdb_rows_slice_seek(tsdb_rows_slice_t *slice, size_t i) FA_HIDDEN;
 
 void tsdb_stmt_init(tsdb_stmt_t *stmt, stmt_t *owner) FA_HIDDEN;
 void tsdb_stmt_unprepare(tsdb_stmt_t *stmt) FA_HIDDEN;
 
 SQLRETURN tsdb_stmt_query(tsdb_stmt_t *stmt, const sqlc_tsdb_t *sqlc_tsdb) FA_HIDDEN;
+SQLRETURN tsdb_stmt_set_tbname(tsdb_stmt_t *stmt) FA_HIDDEN;
 SQLRETURN tsdb_stmt_rebind_subtbl(tsdb_stmt_t *stmt) FA_HIDDEN;
+// NOTE: native backend only, taos_stmt_execute runs on a worker thread until tsdb_stmt_execute_wait
+SQLRETURN tsdb_stmt_execute_start(tsdb_stmt_t *stmt) FA_HIDDEN;
+SQLRETURN tsdb_stmt_execute_wait(tsdb_stmt_t *stmt) FA_HIDDEN;
+// NOTE: native backend only, see PARALLEL_INSERT, one TAOS_STMT per shard connection, each executing on its own worker
+SQLRETURN tsdb_stmt_shards_prepare(tsdb_stmt_t *stmt, size_t nr_shards) FA_HIDDEN;
+SQLRETURN tsdb_stmt_shard_bind(tsdb_stmt_t *stmt, size_t i_shard, const char *subtbl, TAOS_MULTI_BIND *tags, TAOS_MULTI_BIND *cols) FA_HIDDEN;
+SQLRETURN tsdb_stmt_shard_execute_start(tsdb_stmt_t *stmt, size_t i_shard) FA_HIDDEN;
+SQLRETURN tsdb_stmt_shard_execute_wait(tsdb_stmt_t *stmt, size_t i_shard) FA_HIDDEN;
+
+// NOTE: native backend only, see STMT_CACHE, prepared insert statements parked per connection, least recently parked evicted first
+int tsdb_prepared_cache_init(tsdb_prepared_cache_t *cache) FA_HIDDEN;
+void tsdb_prepared_cache_clear(tsdb_prepared_cache_t *cache) FA_HIDDEN;
+void tsdb_prepared_cache_release(tsdb_prepared_cache_t *cache) FA_HIDDEN;
 
 EXTERN_C_END
 
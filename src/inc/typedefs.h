@@ -31,6 +31,8 @@ typedef struct charset_conv_mgr_s       charset_conv_mgr_t;
 typedef struct charset_convs_s          charset_convs_t;
 
 typedef struct col_bind_map_s           col_bind_map_t;
+typedef struct col_bind_meta_s          col_bind_meta_t;
+typedef struct cols_bind_meta_s         cols_bind_meta_t;
 
 typedef struct columns_args_s           columns_args_t;
 typedef struct columns_s                columns_t;
@@ -43,6 +45,9 @@ typedef struct conn_cfg_s               conn_cfg_t;
 
 typedef struct conn_parser_param_s      conn_parser_param_t;
 typedef struct conn_s                   conn_t;
+typedef struct conn_pooled_s            conn_pooled_t;
+typedef struct conn_pool_s              conn_pool_t;
+typedef struct conn_meta_s              conn_meta_t;
 
 typedef struct descriptor_s             descriptor_t;
 typedef struct desc_s                   desc_t;
@@ -62,6 +67,9 @@ typedef struct ds_stmt_s                ds_stmt_t;
 
 typedef struct env_s                    env_t;
 
+typedef struct query_timer_s            query_timer_t;
+typedef struct query_timers_s           query_timers_t;
+
 typedef struct err_s                    err_t;
 typedef struct errs_s                   errs_t;
 
@@ -77,6 +85,9 @@ typedef struct param_bind_meta_s        param_bind_meta_t;
 typedef struct params_bind_meta_s       params_bind_meta_t;
 
 typedef struct param_state_s            param_state_t;
+typedef struct param_subtbl_row_s       param_subtbl_row_t;
+typedef struct param_subtbl_group_s     param_subtbl_group_t;
+typedef struct param_batcher_s          param_batcher_t;
 
 typedef struct primarykeys_args_s       primarykeys_args_t;
 typedef struct primarykeys_s            primarykeys_t;
@@ -113,6 +124,16 @@ typedef struct tsdb_binds_s             tsdb_binds_t;
 typedef struct tsdb_res_s               tsdb_res_t;
 typedef struct tsdb_fields_s            tsdb_fields_t;
 typedef struct tsdb_rows_block_s        tsdb_rows_block_t;
+typedef struct tsdb_rows_block_col_s    tsdb_rows_block_col_t;
+typedef struct tsdb_rows_slice_s        tsdb_rows_slice_t;
+typedef struct tsdb_prefetch_s          tsdb_prefetch_t;
+typedef struct tsdb_pipeline_s          tsdb_pipeline_t;
+typedef struct tsdb_shard_s             tsdb_shard_t;
+typedef struct tsdb_prepared_s          tsdb_prepared_t;
+typedef struct tsdb_prepared_cache_s    tsdb_prepared_cache_t;
+typedef struct tsdb_cached_block_s      tsdb_cached_block_t;
+typedef struct tsdb_res_cache_s         tsdb_res_cache_t;
+typedef struct tsdb_tz_window_s         tsdb_tz_window_t;
 
 typedef struct ts_parser_param_s        ts_parser_param_t;
 
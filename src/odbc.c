@@ -1194,16 +1194,22 @@ SQLRETURN SQL_API SQLBulkOperations(
 }
 #endif                                   /* } */
 
-#if 0                          /* { */
 SQLRETURN SQL_API SQLCancel(SQLHSTMT StatementHandle)
 {
   SQLRETURN sr = SQL_SUCCESS;
 
   OOW("===");
-  (void)StatementHandle;
-  OA_NIY(0);
+  if (StatementHandle == SQL_NULL_HANDLE) return SQL_INVALID_HANDLE;
+
+  stmt_t *stmt = (stmt_t*)StatementHandle;
+
+  // NOTE: no stmt_clr_errs, diagnostics belong to the function that is being canceled in another thread
+  stmt_ref(stmt);
+  sr = stmt_cancel(stmt);
+  stmt_unref(stmt);
+
+  return sr;
 }
-#endif                         /* } */
 
 #if (ODBCVER >= 0x0300)                  /* { */
 SQLRETURN SQL_API SQLCloseCursor(SQLHSTMT StatementHandle)
@@ -26,7 +26,9 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #ifdef _WIN32
+#include <process.h>
 #include <psapi.h>
 #include <windows.h>
 #pragma comment(lib, "psapi.lib")
@@ -125,6 +127,114 @@ int pthread_once(pthread_once_t *once_control, void (*init_routine)(void))
   return -1;
 }
 
+int pthread_mutex_init(pthread_mutex_t *mutex, const void *attr)
+{
+  (void)attr;
+  InitializeSRWLock(mutex);
+  return 0;
+}
+
+int pthread_mutex_destroy(pthread_mutex_t *mutex)
+{
+  (void)mutex;
+  return 0;
+}
+
+int pthread_mutex_lock(pthread_mutex_t *mutex)
+{
+  AcquireSRWLockExclusive(mutex);
+  return 0;
+}
+
+int pthread_mutex_unlock(pthread_mutex_t *mutex)
+{
+  ReleaseSRWLockExclusive(mutex);
+  return 0;
+}
+
+int pthread_cond_init(pthread_cond_t *cond, const void *attr)
+{
+  (void)attr;
+  InitializeConditionVariable(cond);
+  return 0;
+}
+
+int pthread_cond_destroy(pthread_cond_t *cond)
+{
+  (void)cond;
+  return 0;
+}
+
+int pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
+{
+  if (SleepConditionVariableSRW(cond, mutex, INFINITE, 0)) return 0;
+  errno = GetLastError();
+  return -1;
+}
+
+int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime)
+{
+  struct timespec now = {0};
+  timespec_get(&now, TIME_UTC);
+  int64_t ms = ((int64_t)abstime->tv_sec - now.tv_sec) * 1000 + (abstime->tv_nsec - now.tv_nsec) / 1000000;
+  if (ms < 0) ms = 0;
+  if (SleepConditionVariableSRW(cond, mutex, (DWORD)ms, 0)) return 0;
+  if (GetLastError() == ERROR_TIMEOUT) return ETIMEDOUT;
+  errno = GetLastError();
+  return -1;
+}
+
+int pthread_cond_signal(pthread_cond_t *cond)
+{
+  WakeConditionVariable(cond);
+  return 0;
+}
+
+int pthread_cond_broadcast(pthread_cond_t *cond)
+{
+  WakeAllConditionVariable(cond);
+  return 0;
+}
+
+typedef struct win_thread_arg_s          win_thread_arg_t;
+struct win_thread_arg_s {
+  void *(*start_routine)(void*);
+  void  *arg;
+};
+
+static unsigned __stdcall _win_thread_routine(void *arg)
+{
+  win_thread_arg_t ctx = *(win_thread_arg_t*)arg;
+  free(arg);
+  ctx.start_routine(ctx.arg);
+  return 0;
+}
+
+int pthread_create(pthread_t *thread, const void *attr, void *(*start_routine)(void*), void *arg)
+{
+  (void)attr;
+  win_thread_arg_t *ctx = (win_thread_arg_t*)malloc(sizeof(*ctx));
+  if (!ctx) return ENOMEM;
+  ctx->start_routine = start_routine;
+  ctx->arg           = arg;
+  uintptr_t h = _beginthreadex(NULL, 0, _win_thread_routine, ctx, 0, NULL);
+  if (h == 0) {
+    int e = errno;
+    free(ctx);
+    return e ? e : EAGAIN;
+  }
+  *thread = (HANDLE)h;
+  return 0;
+}
+
+int pthread_join(pthread_t thread, void **retval)
+{
+  if (retval) *retval = NULL;
+  if (WaitForSingleObject(thread, INFINITE) != WAIT_OBJECT_0) return EINVAL;
+  CloseHandle(thread);
+  return 0;
+}
+
 static char dl_err[1024] = {0};
 
 void* dlopen(const char* path, int mode)
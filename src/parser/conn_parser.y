@@ -171,6 +171,54 @@
       param->conn_cfg->conn_mode = !!atoi(_s);                                                  \
     } while (0)
 
+    #define SET_PREFETCH(_s, _n, _loc) do {                                                     \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->prefetch = !!atoi(_s);                                                   \
+    } while (0)
+
+    #define SET_CURSOR_CACHE_SIZE(_s, _n, _loc) do {                                            \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->cursor_cache_size = (unsigned int)strtoul(_s, NULL, 10);                 \
+    } while (0)
+
+    #define SET_BATCH_BYTES(_s, _n, _loc) do {                                                  \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->batch_bytes = (unsigned int)strtoul(_s, NULL, 10);                       \
+    } while (0)
+
+    #define SET_PARALLEL_INSERT(_s, _n, _loc) do {                                              \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->parallel_insert = (unsigned int)strtoul(_s, NULL, 10);                   \
+    } while (0)
+
+    #define SET_STMT_CACHE(_s, _n, _loc) do {                                                   \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->stmt_cache = (unsigned int)strtoul(_s, NULL, 10);                        \
+    } while (0)
+
+    #define SET_CONN_POOL(_s, _n, _loc) do {                                                    \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->conn_pool = (unsigned int)strtoul(_s, NULL, 10);                         \
+    } while (0)
+
+    #define SET_META_CACHE_TTL(_s, _n, _loc) do {                                               \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->meta_cache_ttl = (unsigned int)strtoul(_s, NULL, 10);                    \
+    } while (0)
+
+    #define SET_LAZY_INIT(_s, _n, _loc) do {                                                    \
+      if (!param) break;                                                                        \
+      OA_NIY(_s[_n] == '\0');                                                                   \
+      param->conn_cfg->lazy_init = !!atoi(_s);                                                  \
+    } while (0)
+
     #define SET_CUSTOMPRODUCT(_s, _n, _loc) do {                                                \
       if (!param) break;                                                                        \
       if (conn_cfg_set_custom_product(param->conn_cfg, _s, _n)) {                               \
@@ -206,6 +254,8 @@
 %union { char c; }
 
 %token DSN UID PWD DRIVER URL SERVER UNSIGNED_PROMOTION TIMESTAMP_AS_IS CONN_MODE DB
+%token PREFETCH CURSOR_CACHE_SIZE BATCH_BYTES PARALLEL_INSERT STMT_CACHE CONN_POOL
+%token META_CACHE_TTL LAZY_INIT
 %token CUSTOMPRODUCT
 %token CHARSET_FOR_COL_BIND CHARSET_FOR_PARAM_BIND
 %token TOPIC
@@ -307,6 +357,14 @@ attribute:
 | CHARSET_FOR_COL_BIND '=' VALUE               { SET_CHARSET_FOR_COL_BIND($3, @$); }
 | CHARSET_FOR_PARAM_BIND '=' VALUE             { SET_CHARSET_FOR_PARAM_BIND($3, @$); }
 | CONN_MODE '=' DIGITS             { SET_CONN_MODE($3.text, $3.leng, @$); }
+| PREFETCH '=' DIGITS              { SET_PREFETCH($3.text, $3.leng, @$); }
+| CURSOR_CACHE_SIZE '=' DIGITS     { SET_CURSOR_CACHE_SIZE($3.text, $3.leng, @$); }
+| BATCH_BYTES '=' DIGITS           { SET_BATCH_BYTES($3.text, $3.leng, @$); }
+| PARALLEL_INSERT '=' DIGITS       { SET_PARALLEL_INSERT($3.text, $3.leng, @$); }
+| STMT_CACHE '=' DIGITS            { SET_STMT_CACHE($3.text, $3.leng, @$); }
+| CONN_POOL '=' DIGITS             { SET_CONN_POOL($3.text, $3.leng, @$); }
+| META_CACHE_TTL '=' DIGITS        { SET_META_CACHE_TTL($3.text, $3.leng, @$); }
+| LAZY_INIT '=' DIGITS             { SET_LAZY_INIT($3.text, $3.leng, @$); }
 | CUSTOMPRODUCT '=' '{' VALUEX '}' { SET_CUSTOMPRODUCT($4.text, $4.leng, @$); }
 ;
 
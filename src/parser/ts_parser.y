@@ -59,6 +59,81 @@
       return 0;
     }
 
+    static unsigned _digits2(const char *s)
+    {
+      return (unsigned)(s[0] - '0') * 10 + (unsigned)(s[1] - '0');
+    }
+
+    // NOTE: fixed-format `YYYY-MM-DD[ T]hh:mm:ss[.fffffffff][Z|+hhmm|+hh:mm]` without flex/bison
+    //       returns -1 for anything else, leaving it to the grammar to accept or reject
+    static int _parse_fast(const char *s, size_t len, ts_parser_param_t *param, int64_t tz_default)
+    {
+      static const unsigned char _digit_pos[] = {0,1,2,3,5,6,8,9,11,12,14,15,17,18};
+
+      if (len < 19) return -1;
+      if (s[4] != '-' || s[7] != '-' || (s[10] != ' ' && s[10] != 'T') || s[13] != ':' || s[16] != ':') return -1;
+
+      unsigned bad = 0;
+      for (size_t i = 0; i < sizeof(_digit_pos); ++i) {
+        bad |= (unsigned)(unsigned char)(s[_digit_pos[i]] - '0') > 9;
+      }
+      if (bad) return -1;
+
+      int64_t  year = _digits2(s) * 100 + _digits2(s + 2);
+      unsigned mon  = _digits2(s + 5);
+      unsigned day  = _digits2(s + 8);
+      unsigned hour = _digits2(s + 11);
+      unsigned min  = _digits2(s + 14);
+      unsigned sec  = _digits2(s + 17);
+      if (mon < 1 || mon > 12 || day < 1 || day > 31 || hour > 23 || min > 59 || sec > 59) return -1;
+
+      size_t p = 19;
+      unsigned long long frac_nano = 0;
+      uint8_t decimal_digits = 0;
+      if (p < len && s[p] == '.') {
+        ++p;
+        while (p < len && decimal_digits < 10 && (unsigned char)(s[p] - '0') <= 9) {
+          frac_nano = frac_nano * 10 + (unsigned)(s[p] - '0');
+          ++decimal_digits;
+          ++p;
+        }
+        if (decimal_digits == 0 || decimal_digits > 9) return -1;
+        for (uint8_t n = decimal_digits; n < 9; ++n) frac_nano *= 10;
+      }
+
+      int64_t tz_seconds = tz_default;
+      if (p < len) {
+        const char *tz = s + p;
+        size_t n = len - p;
+        if (n == 1 && tz[0] == 'Z') {
+          tz_seconds = 0;
+        } else if (tz[0] == '+' || tz[0] == '-') {
+          unsigned h, m;
+          if (n == 5 && (unsigned char)(tz[1]-'0') <= 9 && (unsigned char)(tz[2]-'0') <= 9 && (unsigned char)(tz[3]-'0') <= 9 && (unsigned char)(tz[4]-'0') <= 9) {
+            h = _digits2(tz + 1);
+            m = _digits2(tz + 3);
+          } else if (n == 6 && tz[3] == ':' && (unsigned char)(tz[1]-'0') <= 9 && (unsigned char)(tz[2]-'0') <= 9 && (unsigned char)(tz[4]-'0') <= 9 && (unsigned char)(tz[5]-'0') <= 9) {
+            h = _digits2(tz + 1);
+            m = _digits2(tz + 4);
+          } else {
+            return -1;
+          }
+          if (h >= 24 || m >= 60) return -1;
+          tz_seconds = (int64_t)(h * 3600 + m * 60);
+          if (tz[0] == '-') tz_seconds = -tz_seconds;
+        } else {
+          return -1;
+        }
+      }
+
+      param->tm_utc0 = (time_t)(tod_days_from_civil(year, (int)mon, (int)day) * 86400 + hour * 3600 + min * 60 + sec - tz_seconds);
+      param->frac_nano       = frac_nano;
+      param->decimal_digits  = decimal_digits;
+      param->tz_seconds      = tz_seconds;
+
+      return 0;
+    }
+
     #define SET_DT(_loc, _fmt) do {                                            \
       const char *next;                                                        \
       size_t _f = _loc.first_column;                                           \
@@ -236,6 +311,8 @@ static void yyerror(
 int ts_parser_parse(const char *input, size_t len, ts_parser_param_t *param,
     int64_t tz_default)
 {
+  if (input && _parse_fast(input, len, param, tz_default) == 0) return 0;
+
   yyscan_t arg = {0};
   yylex_init(&arg);
   // yyset_in(in, arg);
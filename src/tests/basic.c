@@ -23,10 +23,12 @@
  */
 
 #include "../core/internal.h" // FIXME:
+#include "charset.h"
 
 #include "conn.h"
 #include "env.h"
 #include "errs.h"
+#include "fmt.h"
 #include "helpers.h"
 #include "insert_eval.h"
 #include "logger.h"
@@ -37,9 +39,11 @@
 #include "ejson_parser.h"
 #include "url_parser.h"
 #include "tls.h"
+#include "tsdb.h"
 #include "utils.h"
 
 #include <errno.h>
+#include <math.h>
 #include <string.h>
 
 #define DUMP(fmt, ...)          printf(fmt "\n", ##__VA_ARGS__)
@@ -204,6 +208,62 @@ static int test_conn_parser(void)
         .customproduct          = 1,
         .charset_for_col_bind   = "UTF-8",
       },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;PREFETCH=1",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .prefetch               = 1,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;CURSOR_CACHE_SIZE=128",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .cursor_cache_size      = 128,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;BATCH_BYTES=4194304",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .batch_bytes            = 4194304,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;PARALLEL_INSERT=4",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .parallel_insert        = 4,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;STMT_CACHE=16",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .stmt_cache             = 16,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;CONN_POOL=8",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .conn_pool              = 8,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;META_CACHE_TTL=300",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .meta_cache_ttl         = 300,
+      },
+    },{
+      __LINE__,
+      "DSN=TAOS_ODBC_DSN;LAZY_INIT=1",
+      {
+        .dsn                    = "TAOS_ODBC_DSN",
+        .lazy_init              = 1,
+      },
     },
   };
 
@@ -280,6 +340,54 @@ static int test_conn_parser(void)
         r = -1;
         break;
       }
+      if (expected->prefetch != param.conn_cfg->prefetch) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("prefetch expected to be `%d`, but got ==%d==", expected->prefetch, param.conn_cfg->prefetch);
+        r = -1;
+        break;
+      }
+      if (expected->cursor_cache_size != param.conn_cfg->cursor_cache_size) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("cursor_cache_size expected to be `%u`, but got ==%u==", expected->cursor_cache_size, param.conn_cfg->cursor_cache_size);
+        r = -1;
+        break;
+      }
+      if (expected->batch_bytes != param.conn_cfg->batch_bytes) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("batch_bytes expected to be `%u`, but got ==%u==", expected->batch_bytes, param.conn_cfg->batch_bytes);
+        r = -1;
+        break;
+      }
+      if (expected->parallel_insert != param.conn_cfg->parallel_insert) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("parallel_insert expected to be `%u`, but got ==%u==", expected->parallel_insert, param.conn_cfg->parallel_insert);
+        r = -1;
+        break;
+      }
+      if (expected->stmt_cache != param.conn_cfg->stmt_cache) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("stmt_cache expected to be `%u`, but got ==%u==", expected->stmt_cache, param.conn_cfg->stmt_cache);
+        r = -1;
+        break;
+      }
+      if (expected->conn_pool != param.conn_cfg->conn_pool) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("conn_pool expected to be `%u`, but got ==%u==", expected->conn_pool, param.conn_cfg->conn_pool);
+        r = -1;
+        break;
+      }
+      if (expected->meta_cache_ttl != param.conn_cfg->meta_cache_ttl) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("meta_cache_ttl expected to be `%u`, but got ==%u==", expected->meta_cache_ttl, param.conn_cfg->meta_cache_ttl);
+        r = -1;
+        break;
+      }
+      if (expected->lazy_init != param.conn_cfg->lazy_init) {
+        E("parsing[@line:%d]:%s", line, s);
+        E("lazy_init expected to be `%d`, but got ==%d==", expected->lazy_init, param.conn_cfg->lazy_init);
+        r = -1;
+        break;
+      }
     } while (0);
     conn_parser_param_release(&param);
     conn_cfg_release(&parsed);
@@ -923,11 +1031,16 @@ static int test_ts_parser(void)
 
     OK_TS("1970-01-02T12:34:56.123456789+0800",  131696-28800,  123456789),
     OK_TS("1970-01-02T12:34:56.123456789Z",      131696,        123456789),
+    OK_TS("2000-02-29T00:00:00Z",                951782400,     0),
+    OK_TS("1969-12-31 23:59:59.5-0000",          -1,            500000000),
+    OK_TS("1970-1-2 12:34:56",                   131696-TZ,     0),
 
     BAD_TS(""),
     BAD_TS("1970-01-02M12:34:56"),
     BAD_TS("1970-01-02 12:34:56."),
     BAD_TS("1970-01-02 12:34:56.1234567890"),
+    BAD_TS("1970-01-02 12:34:56+08"),
+    BAD_TS("1970-01-02 12:34:56+0800 "),
     BAD_TS("1970-01-02M12:34:56+"),
     BAD_TS("1970-01-02M12:34:56-"),
     BAD_TS("1970-01-02M12:34:56+1"),
@@ -1397,6 +1510,66 @@ static int _test_iconv_perf(iconv_t cnv, iconv_case_t *iconv_case)
   return 0;
 }
 
+static int test_utf8_to_utf16le(void)
+{
+  int r = 0;
+
+  iconv_t cnv = iconv_open("UTF-16LE", "UTF-8");
+  if (cnv == (iconv_t)-1) {
+    int e = errno;
+    E("iconv_open(tocode:UTF-16LE, fromcode:UTF-8) failed:[%d]%s", e, strerror(e));
+    return -1;
+  }
+
+  const char *cases[] = {
+    "",
+    "hello world, ascii only and longer than sixteen bytes",
+    "\xe4\xb8\xad\xe6\x96\x87",                                       // 中文
+    "mixed:\xe4\xb8\xad\xc3\xa9\xf0\x9f\x98\x80 and trailing ascii",  // 中é😀
+  };
+
+  for (size_t i=0; i<sizeof(cases)/sizeof(cases[0]) && r == 0; ++i) {
+    char exp[256], got[256];
+    char *inbuf = (char*)cases[i];
+    size_t inbytesleft = strlen(cases[i]);
+    char *outbuf = exp;
+    size_t outbytesleft = sizeof(exp);
+    size_t n = iconv(cnv, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+    iconv(cnv, NULL, NULL, NULL, NULL);
+    A(n != (size_t)-1, "");
+    size_t nr_exp = sizeof(exp) - outbytesleft;
+
+    size_t bytes = 0;
+    A(charset_utf8_utf16le_bytes(cases[i], strlen(cases[i]), &bytes) == 0, "");
+    A(bytes == nr_exp, "#%zd:%zd expected, but got ==%zd==", i, nr_exp, bytes);
+
+    // NOTE: converting with every possible room, only whole characters are expected
+    for (size_t room=0; room<=nr_exp && r == 0; ++room) {
+      const char *in = cases[i];
+      size_t inlen = strlen(cases[i]);
+      char *out = got;
+      size_t outlen = room;
+      int rr = charset_utf8_to_utf16le(&in, &inlen, &out, &outlen);
+      size_t nr = room - outlen;
+      if (rr < 0 || (rr == 0 && nr != nr_exp) || memcmp(got, exp, nr)) {
+        E("#%zd:conversion with room of %zd bytes failed", i, room);
+        r = -1;
+      }
+    }
+  }
+
+  const char *in = "ab\xe4\xb8";
+  size_t inlen = strlen(in);
+  char buf[16];
+  char *out = buf;
+  size_t outlen = sizeof(buf);
+  A(charset_utf8_to_utf16le(&in, &inlen, &out, &outlen) == -1, "invalid utf-8 expected");
+  A(outlen == sizeof(buf) - 4, "");
+
+  iconv_close(cnv);
+  return r;
+}
+
 static int test_iconv_perf_reuse(void)
 {
   int r = 0;
@@ -1807,6 +1980,235 @@ static int test_gettimeofday(void)
   return 0;
 }
 
+static int test_timestamp_to_local(void)
+{
+  // NOTE: cached utc-offset windows shall agree with localtime_r, across tz-transitions as well
+  const struct {
+    int64_t start;
+    int64_t step;
+    size_t  nr;
+  } ranges[] = {
+    {-2208988800LL, 3607, 400000},
+    {1600000000LL,     1, 200000},
+    {1667000000LL,    59, 200000},
+  };
+
+  for (size_t i=0; i<sizeof(ranges)/sizeof(ranges[0]); ++i) {
+    for (size_t j=0; j<ranges[i].nr; ++j) {
+      int64_t t = ranges[i].start + ranges[i].step * (int64_t)j;
+      SQL_TIMESTAMP_STRUCT ts = {0};
+      if (tsdb_timestamp_to_SQL_C_TYPE_TIMESTAMP(t * 1000 + 123, 0, &ts)) {
+        E("conversion failed:%" PRId64 "", t);
+        return -1;
+      }
+      time_t tt = (time_t)t;
+      struct tm tm = {0};
+      if (!localtime_r(&tt, &tm)) continue;
+      if (ts.year != tm.tm_year + 1900 || ts.month != tm.tm_mon + 1 || ts.day != tm.tm_mday ||
+          ts.hour != tm.tm_hour || ts.minute != tm.tm_min || ts.second != tm.tm_sec ||
+          ts.fraction != 123000000)
+      {
+        E("%" PRId64 ":%04d-%02d-%02d %02d:%02d:%02d expected, but got ==%04d-%02d-%02d %02d:%02d:%02d.%09u==", t,
+          tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+          ts.year, ts.month, ts.day, ts.hour, ts.minute, ts.second, (unsigned int)ts.fraction);
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+typedef struct test_timer_probe_s          test_timer_probe_t;
+struct test_timer_probe_s {
+  pthread_mutex_t          mutex;
+  pthread_cond_t           cond;
+  int                      fired;
+};
+
+static void _test_timer_fire(void *arg)
+{
+  test_timer_probe_t *probe = (test_timer_probe_t*)arg;
+  pthread_mutex_lock(&probe->mutex);
+  probe->fired += 1;
+  pthread_cond_signal(&probe->cond);
+  pthread_mutex_unlock(&probe->mutex);
+}
+
+static int test_query_timer(void)
+{
+  int r = 0;
+
+  env_t *env = env_create();
+  if (!env) return -1;
+
+  test_timer_probe_t probe = {0};
+  pthread_mutex_init(&probe.mutex, NULL);
+  pthread_cond_init(&probe.cond, NULL);
+
+  query_timer_t timers[2] = {0};
+  for (size_t i=0; i<sizeof(timers)/sizeof(timers[0]); ++i) {
+    timers[i].fire = _test_timer_fire;
+    timers[i].arg  = &probe;
+  }
+
+  do {
+    // NOTE: disarmed in time, never fires
+    r = env_timer_arm(env, timers + 0, 30);
+    if (r) break;
+    // NOTE: expires while armed, disarming reports it
+    r = env_timer_arm(env, timers + 1, 1);
+    if (r) {
+      env_timer_disarm(env, timers + 0);
+      break;
+    }
+
+    struct timespec abstime = {0};
+    abstime.tv_sec = time(NULL) + 10;
+    pthread_mutex_lock(&probe.mutex);
+    while (probe.fired == 0 && r == 0) {
+      r = pthread_cond_timedwait(&probe.cond, &probe.mutex, &abstime);
+    }
+    pthread_mutex_unlock(&probe.mutex);
+
+    int fired0 = env_timer_disarm(env, timers + 0);
+    int fired1 = env_timer_disarm(env, timers + 1);
+    if (r) {
+      E("timer of 1 second expected to fire within 10 seconds");
+      r = -1;
+      break;
+    }
+    if (fired0 || !fired1 || probe.fired != 1) {
+      E("only the second timer expected to fire, but got ==%d/%d/%d==", fired0, fired1, probe.fired);
+      r = -1;
+      break;
+    }
+  } while (0);
+
+  env_unref(env);
+  pthread_cond_destroy(&probe.cond);
+  pthread_mutex_destroy(&probe.mutex);
+
+  return r ? -1 : 0;
+}
+
+static int test_fmt(void)
+{
+  char buf[FMT_MAX + 1];
+  char exp[FMT_MAX + 1];
+
+  const int64_t i64s[] = {0, 1, -1, 9, 10, 99, 100, -12345, INT64_MAX, INT64_MIN};
+  for (size_t i=0; i<sizeof(i64s)/sizeof(i64s[0]); ++i) {
+    size_t n = fmt_int64(buf, i64s[i]);
+    snprintf(exp, sizeof(exp), "%" PRId64 "", i64s[i]);
+    if (n != strlen(exp) || strcmp(buf, exp)) {
+      E("%s expected, but got ==%s==", exp, buf);
+      return -1;
+    }
+  }
+
+  const uint64_t u64s[] = {0, 7, 1000, 4294967295ULL, UINT64_MAX};
+  for (size_t i=0; i<sizeof(u64s)/sizeof(u64s[0]); ++i) {
+    size_t n = fmt_uint64(buf, u64s[i]);
+    snprintf(exp, sizeof(exp), "%" PRIu64 "", u64s[i]);
+    if (n != strlen(exp) || strcmp(buf, exp)) {
+      E("%s expected, but got ==%s==", exp, buf);
+      return -1;
+    }
+  }
+
+  const struct {
+    double        v;
+    const char   *s;
+  } dbls[] = {
+    {1.23,           "1.23"},
+    {-2.5,           "-2.5"},
+    {0.1,            "0.1"},
+    {123,            "123"},
+    {1000000,        "1000000"},
+    {0.00001,        "0.00001"},
+    {123456.789,     "123456.789"},
+    {1e300,          "1e+300"},
+    // NOTE: shortest round-trip rather than %g, thus more digits where %g would lose them
+    {1.0/3,          "0.3333333333333333"},
+    {0.1+0.2,        "0.30000000000000004"},
+    {1e-7,           "0.0000001"},
+    {1e16,           "1e+16"},
+    {123456789012345678.0,    "1.2345678901234568e+17"},
+    {1.7976931348623157e308,  "1.7976931348623157e+308"},
+    {5e-324,         "5e-324"},
+    {2.2250738585072009e-308, "2.225073858507201e-308"},
+    {-0.0,           "-0"},
+  };
+  for (size_t i=0; i<sizeof(dbls)/sizeof(dbls[0]); ++i) {
+    fmt_double(buf, dbls[i].v);
+    if (strcmp(buf, dbls[i].s)) {
+      E("%s expected, but got ==%s==", dbls[i].s, buf);
+      return -1;
+    }
+  }
+
+  const struct {
+    float         v;
+    const char   *s;
+  } flts[] = {
+    {3.45f,          "3.45"},
+    // NOTE: a float is rendered by its own shortest round-trip, never by the digits of the widened double
+    {0.1f,           "0.1"},
+    {1.1f,           "1.1"},
+    {-0.5f,          "-0.5"},
+    {100.0f,         "100"},
+    {123.456f,       "123.456"},
+    {1e-5f,          "0.00001"},
+    {1.0f/3,         "0.33333334"},
+    {16777216.0f,    "16777216"},
+    {1e10f,          "1e+10"},
+    {3.4028235e38f,  "3.4028235e+38"},
+    {1e-45f,         "1e-45"},
+    {0.0f,           "0"},
+  };
+  for (size_t i=0; i<sizeof(flts)/sizeof(flts[0]); ++i) {
+    fmt_float(buf, flts[i].v);
+    if (strcmp(buf, flts[i].s)) {
+      E("%s expected, but got ==%s==", flts[i].s, buf);
+      return -1;
+    }
+  }
+
+  // NOTE: round-trip
+  uint64_t seed = 88172645463325252ULL;
+  for (size_t i=0; i<100000; ++i) {
+    seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+    double v;
+    memcpy(&v, &seed, sizeof(v));
+    if (!isfinite(v)) continue;
+    fmt_double(buf, v);
+    if (strtod(buf, NULL) != v) {
+      E("%.17g expected, but got ==%s==", v, buf);
+      return -1;
+    }
+  }
+
+  struct tm tm = {0};
+  tm.tm_year = 2022 - 1900; tm.tm_mon = 9; tm.tm_mday = 6;
+  tm.tm_hour = 11; tm.tm_min = 1; tm.tm_sec = 6;
+  fmt_timestamp(buf, &tm, 43, 6);
+  if (strcmp(buf, "2022-10-06 11:01:06.000043")) {
+    E("2022-10-06 11:01:06.000043 expected, but got ==%s==", buf);
+    return -1;
+  }
+
+  char wbuf[16];
+  strcpy(wbuf, "-12");
+  size_t n = fmt_widen_utf16le(wbuf, 3);
+  if (n != 6 || memcmp(wbuf, "-\0" "1\0" "2\0" "\0\0", 8)) {
+    E("UTF-16LE of `-12` expected");
+    return -1;
+  }
+
+  return 0;
+}
+
 typedef int (*test_case_f)(void);
 
 #define RECORD(x) {x, #x}
@@ -1829,6 +2231,7 @@ static struct {
   RECORD(test_iconv_names),
   RECORD(test_iconv),
   RECORD(test_iconvs),
+  RECORD(test_utf8_to_utf16le),
   RECORD(test_iconv_perf_reuse),
   RECORD(test_iconv_perf_on_the_fly),
   RECORD(test_iconv_full),
@@ -1842,6 +2245,9 @@ static struct {
   RECORD(test_buffer),
   RECORD(test_trim),
   RECORD(test_gettimeofday),
+  RECORD(test_timestamp_to_local),
+  RECORD(test_query_timer),
+  RECORD(test_fmt),
 };
 
 static void usage(const char *arg0)
@@ -75,6 +75,137 @@ static int _driver_connect(SQLHANDLE hconn, const char *connstr)
   return 0;
 }
 
+static int _driver_connect_with(SQLHANDLE hconn, const conn_arg_t *conn_arg, const char *extra)
+{
+  char connstr[1024];
+
+  if (conn_arg->connstr) {
+    snprintf(connstr, sizeof(connstr), "%s;%s", conn_arg->connstr, extra);
+  } else {
+    // NOTE: uid/pwd kept in the dsn unless given explicitly
+    snprintf(connstr, sizeof(connstr), "DSN=%s;%s%s%s%s%s%s%s",
+        conn_arg->dsn ? conn_arg->dsn : "TAOS_ODBC_DSN",
+        conn_arg->uid ? "UID=" : "", conn_arg->uid ? conn_arg->uid : "", conn_arg->uid ? ";" : "",
+        conn_arg->pwd ? "PWD=" : "", conn_arg->pwd ? conn_arg->pwd : "", conn_arg->pwd ? ";" : "",
+        extra);
+  }
+
+  return _driver_connect(hconn, connstr);
+}
+
+static int _exec_and_get_sbigint(SQLHANDLE hconn, const char *sql, int64_t *v)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)sql, SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (sr == SQL_NO_DATA) {
+      E("[%s]:one row expected, but got none", sql);
+      r = -1;
+      break;
+    }
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, v, sizeof(*v), NULL);
+    if (FAILED(sr)) break;
+  } while (0);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int _exec_and_get_str(SQLHANDLE hconn, const char *sql, char *buf, size_t sz)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+  SQLLEN ind = 0;
+
+  buf[0] = '\0';
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)sql, SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (sr == SQL_NO_DATA) {
+      E("[%s]:one row expected, but got none", sql);
+      r = -1;
+      break;
+    }
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_CHAR, buf, (SQLLEN)sz, &ind);
+    if (FAILED(sr)) break;
+    if (ind == SQL_NULL_DATA) buf[0] = '\0';
+  } while (0);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int _check_sqlstate(SQLSMALLINT HandleType, SQLHANDLE Handle, const char *expected)
+{
+  SQLCHAR sqlState[6]; sqlState[0] = '\0';
+  SQLINTEGER nativeErrno = 0;
+  SQLCHAR messageText[1024]; messageText[0] = '\0';
+  SQLSMALLINT textLength = 0;
+
+  SQLRETURN sr = SQLGetDiagRec(HandleType, Handle, 1, sqlState, &nativeErrno, messageText, sizeof(messageText), &textLength);
+  if (sr != SQL_SUCCESS && sr != SQL_SUCCESS_WITH_INFO) {
+    E("sqlstate `%s` expected, but got no diagnostics", expected);
+    return -1;
+  }
+  if (strcmp((const char*)sqlState, expected)) {
+    E("sqlstate `%s` expected, but got ==%s==:%s", expected, (const char*)sqlState, (const char*)messageText);
+    return -1;
+  }
+
+  return 0;
+}
+
+static int _run_with_conn(const conn_arg_t *conn_arg, const char *extra, int (*run)(SQLHANDLE hconn))
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE henv = SQL_NULL_HANDLE;
+  SQLHANDLE hconn = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &henv);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLSetEnvAttr(henv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER)SQL_OV_ODBC3, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLAllocHandle(SQL_HANDLE_DBC, henv, &hconn);
+    if (FAILED(sr)) break;
+
+    r = _driver_connect_with(hconn, conn_arg, extra);
+    if (r) break;
+
+    r = run(hconn);
+
+    CALL_SQLDisconnect(hconn);
+  } while (0);
+
+  if (hconn) CALL_SQLFreeHandle(SQL_HANDLE_DBC, hconn);
+  CALL_SQLFreeHandle(SQL_HANDLE_ENV, henv);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
 static int _exec_direct(SQLHANDLE hconn, const char *sql)
 {
   int r = 0;
@@ -664,7 +795,7 @@ static int select_count_with_col_bind_array(SQLHANDLE hconn, const char *sql, si
   return (r || FAILED(sr)) ? -1 : 0;
 }
 
-static int test_case4(SQLHANDLE hconn, int non_taos, const size_t dataset, const size_t array_size)
+static int test_case4(SQLHANDLE hconn, const size_t dataset, const size_t array_size)
 {
   int r = 0;
 
@@ -705,12 +836,9 @@ static int test_case4(SQLHANDLE hconn, int non_taos, const size_t dataset, const
     return -1;
   }
   if (batches != (dataset + array_size - 1) / array_size) {
-    // TODO: SQLFetch for taos-odbc is still not fully implemented yet
-    // https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlfetch-function?view=sql-server-ver16#positioning-the-cursor
-    if (non_taos) {
-      E("%zd in total, batches[%zd] expected, but got ==%zd==", count, (dataset + array_size - 1) / array_size, batches);
-      return -1;
-    }
+    // NOTE: rowsets shall be full-width even if they span fetch-blocks
+    E("%zd in total, batches[%zd] expected, but got ==%zd==", count, (dataset + array_size - 1) / array_size, batches);
+    return -1;
   }
 
   return 0;
@@ -1686,121 +1814,2071 @@ struct param_s {
   SQLLEN         *StrLen_or_IndPtr;
 };
 
-static int test_bind_params_with_stmt(SQLHANDLE hconn, SQLHANDLE hstmt)
+static int test_case10(SQLHANDLE hconn)
 {
   int r = 0;
   SQLRETURN sr = SQL_SUCCESS;
-  char buf[1024];
-  simple_str_t str = {
-    .base           = buf,
-    .cap            = sizeof(buf),
-    .nr             = 0,
-  };
-
-  const char *database = "foo";
-
-  if (_under_taos_mysql_sqlite3 != 2) {
-    r = _exec_(hstmt, "drop database if exists %s", database);
-    if (r) return -1;
-    r = _exec_(hstmt, "create database if not exists %s", database);
-    if (r) return -1;
-    r = _exec_(hstmt, "use %s", database);
-    if (r) return -1;
-  }
 
-  const char *table = "t";
-  field_t fields[] = {
-    {"ts", "timestamp"},
-    {"vname", "varchar(10)"},
-    {"wname", "nchar(10)"},
-    {"bi", "bigint"},
+  const char *sqls[] = {
+    "drop table if exists t",
+    "create table t (ts timestamp, bi bigint, d double, i int)",
+    "insert into t (ts, bi, d, i) values ('2022-10-12 13:14:15', 1, 1.5, 10)",
+    "insert into t (ts, bi, d, i) values ('2022-10-12 13:14:16', null, 2.5, null)",
+    "insert into t (ts, bi, d, i) values ('2022-10-12 13:14:17', 3, null, 30)",
   };
-  if (_under_taos_mysql_sqlite3) {
-    fields[0].field = "bigint";
-  }
 
-  r = _exec_(hstmt, "drop table if exists %s", table);
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
   if (r) return -1;
 
-  r = _gen_table_create_sql(&str, table, fields, sizeof(fields)/sizeof(fields[0]));
-  if (r) return -1;
-  sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)buf, SQL_NTS);
-  if (sr == SQL_ERROR) return -1;
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
 
-#define ARRAY_SIZE 10
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
 
-  SQLUSMALLINT param_status_arr[ARRAY_SIZE] = {0};
-  SQLULEN nr_params_processed = 0;
-  int64_t ts_arr[ARRAY_SIZE] = {1662861448751};
-  SQLLEN  ts_ind[ARRAY_SIZE] = {0};
-  char    varchar_arr[ARRAY_SIZE][100];
-  SQLLEN  varchar_ind[ARRAY_SIZE] = {0};
-  char    nchar_arr[ARRAY_SIZE][100];
-  SQLLEN  nchar_ind[ARRAY_SIZE] = {0};
-  int64_t i64_arr[ARRAY_SIZE] = {1662861448751};
-  SQLLEN  i64_ind[ARRAY_SIZE] = {0};
+#define ARRAY_SIZE 2
+  SQL_TIMESTAMP_STRUCT ts[ARRAY_SIZE];
+  SQLLEN ts_ind[ARRAY_SIZE];
+  int64_t bi[ARRAY_SIZE];
+  SQLLEN bi_ind[ARRAY_SIZE];
+  double d[ARRAY_SIZE];
+  SQLLEN d_ind[ARRAY_SIZE];
+  int32_t i[ARRAY_SIZE];
+  SQLLEN i_ind[ARRAY_SIZE];
+  SQLUSMALLINT status[ARRAY_SIZE];
+  SQLULEN nr_rows = 0;
+  do {
+    sr = CALL_SQLBindCol(hstmt, 1, SQL_C_TYPE_TIMESTAMP, ts, 0, ts_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 2, SQL_C_SBIGINT, bi, 0, bi_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 3, SQL_C_DOUBLE, d, 0, d_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 4, SQL_C_SLONG, i, 0, i_ind);
+    if (FAILED(sr)) break;
 
-  const param_t params[] = {
-    {SQL_PARAM_INPUT,  SQL_C_SBIGINT,  SQL_TYPE_TIMESTAMP,  23,       3,          ts_arr,           0,   ts_ind},
-    {SQL_PARAM_INPUT,  SQL_C_CHAR,     SQL_VARCHAR,         99,       0,          varchar_arr,      100, varchar_ind},
-    {SQL_PARAM_INPUT,  SQL_C_CHAR,     SQL_WVARCHAR,        99,       0,          nchar_arr,        100, nchar_ind},
-    {SQL_PARAM_INPUT,  SQL_C_SBIGINT,  SQL_BIGINT,          99,       0,          i64_arr,          100, i64_ind},
-  };
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &nr_rows, 0);
+    if (FAILED(sr)) break;
 
-  SQLULEN nr_paramset_size = 4;
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select ts, bi, d, i from t order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
 
-  for (int i=0; i<ARRAY_SIZE; ++i) {
-    ts_arr[i] = 1662861448751 + i;
-    snprintf(varchar_arr[i], 100, "a人%d", i);
-    varchar_ind[i] = SQL_NTS;
-    snprintf(nchar_arr[i], 100, "b民%d", i);
-    nchar_ind[i] = SQL_NTS;
-    i64_arr[i] = 54321 + i;
-  }
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    if (nr_rows != 2 || status[0] != SQL_ROW_SUCCESS || status[1] != SQL_ROW_SUCCESS) {
+      E("2 rows expected, but got ==%zd==", (size_t)nr_rows);
+      r = -1;
+      break;
+    }
+    if (ts_ind[0] == SQL_NULL_DATA || ts_ind[1] == SQL_NULL_DATA || ts[0].year != 2022 || ts[1].second != (ts[0].second + 1) % 60) {
+      E("unexpected timestamps");
+      r = -1;
+      break;
+    }
+    if (bi_ind[0] == SQL_NULL_DATA || bi[0] != 1 || bi_ind[1] != SQL_NULL_DATA) {
+      E("unexpected bigints");
+      r = -1;
+      break;
+    }
+    if (d_ind[0] == SQL_NULL_DATA || d[0] != 1.5 || d_ind[1] == SQL_NULL_DATA || d[1] != 2.5) {
+      E("unexpected doubles");
+      r = -1;
+      break;
+    }
+    if (i_ind[0] == SQL_NULL_DATA || i[0] != 10 || i_ind[1] != SQL_NULL_DATA) {
+      E("unexpected ints");
+      r = -1;
+      break;
+    }
 
-  str.nr = 0;
-  r = _gen_table_param_insert(&str, table, fields, sizeof(fields)/sizeof(fields[0]));
-  if (r) return -1;
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    if (nr_rows != 1 || status[0] != SQL_ROW_SUCCESS || status[1] != SQL_ROW_NOROW) {
+      E("1 row expected, but got ==%zd==", (size_t)nr_rows);
+      r = -1;
+      break;
+    }
+    if (bi_ind[0] == SQL_NULL_DATA || bi[0] != 3 || d_ind[0] != SQL_NULL_DATA || i_ind[0] == SQL_NULL_DATA || i[0] != 30) {
+      E("unexpected values in the last row");
+      r = -1;
+      break;
+    }
 
-  sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)buf, SQL_NTS);
-  if (sr == SQL_ERROR) return -1;
+    sr = CALL_SQLFetch(hstmt);
+    if (sr != SQL_NO_DATA) {
+      E("SQL_NO_DATA expected, but got ==%s==", sql_return_type(sr));
+      r = -1;
+      break;
+    }
+    sr = SQL_SUCCESS;
+  } while (0);
+#undef ARRAY_SIZE
 
-  // Set the SQL_ATTR_PARAM_BIND_TYPE statement attribute to use
-  // column-wise binding.
-  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_BIND_TYPE, SQL_PARAM_BIND_BY_COLUMN, 0);
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
 
-  // Specify the number of elements in each parameter array.
-  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)(uintptr_t)nr_paramset_size, 0);
+  return (r || FAILED(sr)) ? -1 : 0;
+}
 
-  // Specify an array in which to return the status of each set of
-  // parameters.
-  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, param_status_arr, 0);
+static int test_case11(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
 
-  // Specify an SQLUINTEGER value in which to return the number of sets of
-  // parameters processed.
-  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_params_processed, 0);
+  const char *sqls[] = {
+    "drop table if exists t",
+    "create table t (ts timestamp, bi bigint, name varchar(20), i int)",
+    "insert into t (ts, bi, name, i) values ('2022-10-12 13:14:15', 1, 'hello', 10)",
+    "insert into t (ts, bi, name, i) values ('2022-10-12 13:14:16', null, 'world', null)",
+    "insert into t (ts, bi, name, i) values ('2022-10-12 13:14:17', 3, null, 30)",
+  };
 
-  // Bind the parameters in column-wise fashion.
-  for (size_t i=0; i<sizeof(params)/sizeof(params[0]); ++i) {
-    const param_t *param = params + i;
-    sr = CALL_SQLBindParameter(hstmt, (SQLUSMALLINT)i+1,
-        param->InputOutputType,
-        param->ValueType,
-        param->ParameterType,
-        param->ColumnSize,
-        param->DecimalDigits,
-        param->ParameterValuePtr,
-        param->BufferLength,
-        param->StrLen_or_IndPtr);
-    if (sr == SQL_ERROR) return -1;
-  }
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
 
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
 
-  // Set part ID, description, and price.
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
 
-  // Execute the statement.
-  sr = CALL_SQLExecute(hstmt);
-  if (sr == SQL_ERROR) return -1;
+#define ARRAY_SIZE 4
+  struct {
+    int64_t       bi;
+    SQLLEN        bi_ind;
+    char          name[21];
+    SQLLEN        name_len;
+    int32_t       i;
+    SQLLEN        i_ind;
+  } rows[ARRAY_SIZE];
+  SQLUSMALLINT status[ARRAY_SIZE];
+  SQLULEN nr_rows = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)sizeof(rows[0]), 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &nr_rows, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindCol(hstmt, 1, SQL_C_SBIGINT, &rows[0].bi, 0, &rows[0].bi_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 2, SQL_C_CHAR, rows[0].name, sizeof(rows[0].name), &rows[0].name_len);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 3, SQL_C_SLONG, &rows[0].i, 0, &rows[0].i_ind);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select bi, name, i from t order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    if (nr_rows != 3 || status[2] != SQL_ROW_SUCCESS || status[3] != SQL_ROW_NOROW) {
+      E("3 rows expected, but got ==%zd==", (size_t)nr_rows);
+      r = -1;
+      break;
+    }
+    if (rows[0].bi_ind == SQL_NULL_DATA || rows[0].bi != 1 || rows[1].bi_ind != SQL_NULL_DATA || rows[2].bi != 3) {
+      E("unexpected bigints");
+      r = -1;
+      break;
+    }
+    if (strcmp(rows[0].name, "hello") || strcmp(rows[1].name, "world") || rows[1].name_len != 5 || rows[2].name_len != SQL_NULL_DATA) {
+      E("unexpected names");
+      r = -1;
+      break;
+    }
+    if (rows[0].i != 10 || rows[1].i_ind != SQL_NULL_DATA || rows[2].i_ind == SQL_NULL_DATA || rows[2].i != 30) {
+      E("unexpected ints");
+      r = -1;
+      break;
+    }
+
+    sr = CALL_SQLFetch(hstmt);
+    if (sr != SQL_NO_DATA) {
+      E("SQL_NO_DATA expected, but got ==%s==", sql_return_type(sr));
+      r = -1;
+      break;
+    }
+    sr = SQL_SUCCESS;
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int _test_case12_fetch(SQLHANDLE hstmt, SQLSMALLINT orientation, SQLLEN offset, SQLRETURN expected, int64_t first, SQLULEN nr_expected, int64_t *bis, SQLULEN *nr_rows)
+{
+  SQLRETURN sr = CALL_SQLFetchScroll(hstmt, orientation, offset);
+  if (sr != expected) {
+    E("[%s/%d]:%s expected, but got ==%s==", sql_fetch_orientation(orientation), (int)offset, sql_return_type(expected), sql_return_type(sr));
+    return -1;
+  }
+  if (sr == SQL_NO_DATA) return 0;
+  if (*nr_rows != nr_expected) {
+    E("[%s/%d]:%zd rows expected, but got ==%zd==", sql_fetch_orientation(orientation), (int)offset, (size_t)nr_expected, (size_t)*nr_rows);
+    return -1;
+  }
+  for (size_t i=0; i<*nr_rows; ++i) {
+    if (bis[i] != first + (int64_t)i) {
+      E("[%s/%d]:row #%zd:%" PRId64 " expected, but got ==%" PRId64 "==", sql_fetch_orientation(orientation), (int)offset, i+1, first + (int64_t)i, bis[i]);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static int test_case12(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t",
+    "create table t (ts timestamp, bi bigint)",
+    "insert into t (ts, bi) values ('2022-10-12 13:14:15', 1)",
+    "insert into t (ts, bi) values ('2022-10-12 13:14:16', 2)",
+    "insert into t (ts, bi) values ('2022-10-12 13:14:17', 3)",
+    "insert into t (ts, bi) values ('2022-10-12 13:14:18', 4)",
+    "insert into t (ts, bi) values ('2022-10-12 13:14:19', 5)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 2
+  int64_t bis[ARRAY_SIZE];
+  SQLLEN  inds[ARRAY_SIZE];
+  SQLULEN nr_rows = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &nr_rows, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 1, SQL_C_SBIGINT, bis, 0, inds);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select bi from t order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    r = _test_case12_fetch(hstmt, SQL_FETCH_LAST,     0, SQL_SUCCESS, 4, 2, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_PRIOR,    0, SQL_SUCCESS, 2, 2, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_ABSOLUTE, 5, SQL_SUCCESS, 5, 1, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_NEXT,     0, SQL_NO_DATA, 0, 0, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_PRIOR,    0, SQL_SUCCESS, 4, 2, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_RELATIVE, -1, SQL_SUCCESS, 3, 2, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_FIRST,    0, SQL_SUCCESS, 1, 2, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_PRIOR,    0, SQL_NO_DATA, 0, 0, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_NEXT,     0, SQL_SUCCESS, 1, 2, bis, &nr_rows);
+    if (r) break;
+    r = _test_case12_fetch(hstmt, SQL_FETCH_NEXT,     0, SQL_SUCCESS, 3, 2, bis, &nr_rows);
+    if (r) break;
+    sr = SQL_SUCCESS;
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case13(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop stable if exists s13",
+    "create stable s13 (ts timestamp, v int) tags (id int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 6
+  // NOTE: rows interleaved among subtables
+  char    tbnames[ARRAY_SIZE][8]  = {"s13_a", "s13_b", "s13_a", "s13_b", "s13_c", "s13_a"};
+  SQLLEN  tbname_lens[ARRAY_SIZE] = {SQL_NTS, SQL_NTS, SQL_NTS, SQL_NTS, SQL_NTS, SQL_NTS};
+  int32_t ids[ARRAY_SIZE]         = {1, 2, 1, 2, 3, 1};
+  int64_t tss[ARRAY_SIZE]         = {1665551655000, 1665551655000, 1665551656000, 1665551656000, 1665551655000, 1665551657000};
+  int32_t vs[ARRAY_SIZE]          = {0, 1, 2, 3, 4, 5};
+  SQLUSMALLINT status[ARRAY_SIZE];
+  SQLULEN nr_processed = 0;
+  int64_t sum = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into ? using s13 tags (?) values (?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(tbnames[0]), 0, tbnames[0], sizeof(tbnames[0]), tbname_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, ids, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 4, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, vs, 0, NULL);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      if (status[i] != SQL_PARAM_SUCCESS) {
+        E("param #%zd:SQL_PARAM_SUCCESS expected, but got ==%d==", i+1, status[i]);
+        r = -1;
+        break;
+      }
+    }
+    if (r) break;
+
+    sr = CALL_SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select sum(v) from s13_a", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &sum, sizeof(sum), NULL);
+    if (FAILED(sr)) break;
+    if (sum != 0 + 2 + 5) {
+      E("s13_a:sum of 7 expected, but got ==%" PRId64 "==", sum);
+      r = -1;
+      break;
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case14(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t14",
+    "create table t14 (ts timestamp, name varchar(20), bin varbinary(20))",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 4
+  // NOTE: column-wise arrays with mixed length/indicator kinds, bound in place when possible
+  int64_t tss[ARRAY_SIZE]         = {1665551655000, 1665551656000, 1665551657000, 1665551658000};
+  char    names[ARRAY_SIZE][8]    = {"hello", "worldxx", "", "abc"};
+  SQLLEN  name_lens[ARRAY_SIZE]   = {SQL_NTS, 5, SQL_NULL_DATA, 3};
+  char    bins[ARRAY_SIZE][4]     = {"\x01\x02", "\x03", "", "\x04\x05\x06"};
+  SQLLEN  bin_lens[ARRAY_SIZE]    = {2, 1, SQL_NULL_DATA, 3};
+  const char *expected[ARRAY_SIZE] = {"hello", "world", NULL, "abc"};
+  SQLULEN nr_processed = 0;
+  char    name[21];
+  SQLLEN  name_len = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into t14 (ts, name, bin) values (?, ?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, 20, 0, names[0], sizeof(names[0]), name_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_BINARY, SQL_VARBINARY, 20, 0, bins[0], sizeof(bins[0]), bin_lens);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+
+    sr = CALL_SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select name from t14 order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      sr = CALL_SQLFetch(hstmt);
+      if (FAILED(sr)) break;
+      sr = CALL_SQLGetData(hstmt, 1, SQL_C_CHAR, name, sizeof(name), &name_len);
+      if (FAILED(sr)) break;
+      if (expected[i] == NULL ? name_len != SQL_NULL_DATA : (name_len == SQL_NULL_DATA || strcmp(name, expected[i]))) {
+        E("row #%zd:`%s` expected, but got ==%s==", i+1, expected[i] ? expected[i] : "null", name_len == SQL_NULL_DATA ? "null" : name);
+        r = -1;
+        break;
+      }
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case15(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t15",
+    "create table t15 (ts timestamp, i int, d double)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 5
+  // NOTE: plain decimals are converted column-at-a-time, the others fall back to strtoll/strtod row by row
+  int64_t tss[ARRAY_SIZE]         = {1665551655000, 1665551656000, 1665551657000, 1665551658000, 1665551659000};
+  char    is[ARRAY_SIZE][16]      = {"12", "-2147483648", "0x10", " 7", ""};
+  SQLLEN  i_lens[ARRAY_SIZE]      = {SQL_NTS, SQL_NTS, SQL_NTS, SQL_NTS, SQL_NULL_DATA};
+  char    ds[ARRAY_SIZE][16]      = {"1.5", "-0.125", "1e3", "", "3"};
+  SQLLEN  d_lens[ARRAY_SIZE]      = {SQL_NTS, SQL_NTS, SQL_NTS, SQL_NULL_DATA, SQL_NTS};
+  const int64_t  i_expected[ARRAY_SIZE] = {12, INT32_MIN, 16, 7, 0};
+  const double   d_expected[ARRAY_SIZE] = {1.5, -0.125, 1000, 0, 3};
+  SQLULEN nr_processed = 0;
+  int64_t i = 0;
+  SQLLEN  i_ind = 0;
+  double  d = 0;
+  SQLLEN  d_ind = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into t15 (ts, i, d) values (?, ?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, 15, 0, is[0], sizeof(is[0]), i_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, 15, 0, ds[0], sizeof(ds[0]), d_lens);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+
+    sr = CALL_SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select i, d from t15 order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+    for (size_t k=0; k<ARRAY_SIZE; ++k) {
+      sr = CALL_SQLFetch(hstmt);
+      if (FAILED(sr)) break;
+      sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &i, sizeof(i), &i_ind);
+      if (FAILED(sr)) break;
+      sr = CALL_SQLGetData(hstmt, 2, SQL_C_DOUBLE, &d, sizeof(d), &d_ind);
+      if (FAILED(sr)) break;
+      if ((i_lens[k] == SQL_NULL_DATA) != (i_ind == SQL_NULL_DATA) || (i_ind != SQL_NULL_DATA && i != i_expected[k])) {
+        E("row #%zd:unexpected int", k+1);
+        r = -1;
+        break;
+      }
+      if ((d_lens[k] == SQL_NULL_DATA) != (d_ind == SQL_NULL_DATA) || (d_ind != SQL_NULL_DATA && d != d_expected[k])) {
+        E("row #%zd:unexpected double", k+1);
+        r = -1;
+        break;
+      }
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case16(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop stable if exists s16",
+    "create stable s16 (ts timestamp, v int) tags (id int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 80000
+  // NOTE: two subtables of 40000 rows each, thus 4 batches, each executed while the next one is being converted
+  char    (*tbnames)[8] = (char (*)[8])malloc(sizeof(*tbnames) * ARRAY_SIZE);
+  SQLLEN   *tbname_lens = (SQLLEN*)malloc(sizeof(*tbname_lens) * ARRAY_SIZE);
+  int32_t  *ids         = (int32_t*)malloc(sizeof(*ids) * ARRAY_SIZE);
+  int64_t  *tss         = (int64_t*)malloc(sizeof(*tss) * ARRAY_SIZE);
+  int32_t  *vs          = (int32_t*)malloc(sizeof(*vs) * ARRAY_SIZE);
+  SQLUSMALLINT *status  = (SQLUSMALLINT*)malloc(sizeof(*status) * ARRAY_SIZE);
+  SQLULEN nr_processed = 0;
+  SQLULEN pipelined = 0;
+  SQLULEN batch_rows = 0;
+  int64_t count = 0;
+  int64_t sum = 0;
+  do {
+    if (!tbnames || !tbname_lens || !ids || !tss || !vs || !status) {
+      E("out of memory");
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      snprintf(tbnames[i], sizeof(tbnames[i]), "s16_%c", (i % 2) ? 'b' : 'a');
+      tbname_lens[i] = SQL_NTS;
+      ids[i] = (int32_t)(i % 2);
+      tss[i] = 1665551655000 + (int64_t)(i / 2);
+      vs[i]  = (int32_t)i;
+    }
+
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_TAOS_PIPELINED_INSERT, (SQLPOINTER)SQL_TAOS_PIPELINED_INSERT_ON, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetStmtAttr(hstmt, SQL_ATTR_TAOS_PIPELINED_INSERT, &pipelined, sizeof(pipelined), NULL);
+    if (FAILED(sr)) break;
+    if (pipelined != SQL_TAOS_PIPELINED_INSERT_ON) {
+      E("SQL_TAOS_PIPELINED_INSERT_ON expected, but got ==%zd==", (size_t)pipelined);
+      r = -1;
+      break;
+    }
+
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into ? using s16 tags (?) values (?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(tbnames[0]), 0, tbnames[0], sizeof(tbnames[0]), tbname_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, ids, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 4, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, vs, 0, NULL);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      if (status[i] != SQL_PARAM_SUCCESS) {
+        E("param #%zd:SQL_PARAM_SUCCESS expected, but got ==%d==", i+1, status[i]);
+        r = -1;
+        break;
+      }
+    }
+    if (r) break;
+
+    sr = CALL_SQLGetStmtAttr(hstmt, SQL_ATTR_TAOS_INSERT_BATCH_ROWS, &batch_rows, sizeof(batch_rows), NULL);
+    if (FAILED(sr)) break;
+    if (batch_rows == 0 || batch_rows > ARRAY_SIZE / 2) {
+      E("last batch:1 to %d rows expected, but got ==%zd==", ARRAY_SIZE / 2, (size_t)batch_rows);
+      r = -1;
+      break;
+    }
+
+    sr = CALL_SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select count(*), sum(v) from s16", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &count, sizeof(count), NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 2, SQL_C_SBIGINT, &sum, sizeof(sum), NULL);
+    if (FAILED(sr)) break;
+    if (count != ARRAY_SIZE || sum != (int64_t)ARRAY_SIZE * (ARRAY_SIZE - 1) / 2) {
+      E("s16:unexpected count/sum, got ==%" PRId64 "/%" PRId64 "==", count, sum);
+      r = -1;
+      break;
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  free(tbnames);
+  free(tbname_lens);
+  free(ids);
+  free(tss);
+  free(vs);
+  free(status);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case17(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t17",
+    "create table t17 (ts timestamp, v int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 10
+  // NOTE: rows #4 and #8 fail conversion, the rest is still sent in one batch
+  int64_t      tss[ARRAY_SIZE];
+  char         vs[ARRAY_SIZE][16];
+  SQLLEN       v_lens[ARRAY_SIZE];
+  SQLUSMALLINT status[ARRAY_SIZE] = {0};
+  SQLULEN      nr_processed = 0;
+  int64_t      count = 0;
+  int64_t      sum = 0;
+  do {
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      tss[i] = 1665551655000 + (int64_t)i;
+      if (i == 3 || i == 7) snprintf(vs[i], sizeof(vs[i]), "bad");
+      else                  snprintf(vs[i], sizeof(vs[i]), "%zd", i);
+      v_lens[i] = SQL_NTS;
+    }
+
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_TAOS_CONTINUE_ON_ERROR, (SQLPOINTER)SQL_TAOS_CONTINUE_ON_ERROR_ON, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into t17 (ts, v) values (?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_INTEGER, 0, 0, vs, sizeof(vs[0]), v_lens);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (sr != SQL_SUCCESS_WITH_INFO) {
+      E("SQL_SUCCESS_WITH_INFO expected, but got ==%s==", sql_return_type(sr));
+      r = -1;
+      break;
+    }
+
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      SQLUSMALLINT expected = (i == 3 || i == 7) ? SQL_PARAM_ERROR : SQL_PARAM_SUCCESS;
+      if (status[i] != expected) {
+        E("param #%zd:%d expected, but got ==%d==", i+1, expected, status[i]);
+        r = -1;
+        break;
+      }
+    }
+    if (r) break;
+
+    sr = CALL_SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select count(*), sum(v) from t17", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &count, sizeof(count), NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 2, SQL_C_SBIGINT, &sum, sizeof(sum), NULL);
+    if (FAILED(sr)) break;
+    if (count != ARRAY_SIZE - 2 || sum != (int64_t)ARRAY_SIZE * (ARRAY_SIZE - 1) / 2 - 3 - 7) {
+      E("t17:unexpected count/sum, got ==%" PRId64 "/%" PRId64 "==", count, sum);
+      r = -1;
+      break;
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case18(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  SQLULEN timeout = 0;
+  int64_t count = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER)30, 0);
+    if (FAILED(sr)) break;
+    // NOTE: websocket backend substitutes it by 0 with SQL_SUCCESS_WITH_INFO
+    SQLULEN expected = (sr == SQL_SUCCESS) ? 30 : 0;
+    sr = CALL_SQLGetStmtAttr(hstmt, SQL_ATTR_QUERY_TIMEOUT, &timeout, sizeof(timeout), NULL);
+    if (FAILED(sr)) break;
+    if (timeout != expected) {
+      E("SQL_ATTR_QUERY_TIMEOUT:%zd expected, but got ==%zd==", (size_t)expected, (size_t)timeout);
+      r = -1;
+      break;
+    }
+
+    // NOTE: arm and disarm without expiring
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select count(*) from t17", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &count, sizeof(count), NULL);
+    if (FAILED(sr)) break;
+    if (count != 8) {
+      E("t17:8 rows expected, but got ==%" PRId64 "==", count);
+      r = -1;
+      break;
+    }
+  } while (0);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case19(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  int64_t count = 0;
+  do {
+    // NOTE: nothing is running, thus a no-op which shall not cancel what follows
+    sr = CALL_SQLCancel(hstmt);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select count(*) from t17", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLCancel(hstmt);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &count, sizeof(count), NULL);
+    if (FAILED(sr)) break;
+    if (count != 8) {
+      E("t17:8 rows expected, but got ==%" PRId64 "==", count);
+      r = -1;
+      break;
+    }
+  } while (0);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case20(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop stable if exists s20",
+    "create stable s20 (ts timestamp, v int) tags (id int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define NR_SUBTBLS 8
+#define ARRAY_SIZE 8000
+  // NOTE: subtables interleaved row by row, thus every shard gets batches of several subtables in turn
+  char    (*tbnames)[8] = (char (*)[8])malloc(sizeof(*tbnames) * ARRAY_SIZE);
+  SQLLEN   *tbname_lens = (SQLLEN*)malloc(sizeof(*tbname_lens) * ARRAY_SIZE);
+  int32_t  *ids         = (int32_t*)malloc(sizeof(*ids) * ARRAY_SIZE);
+  int64_t  *tss         = (int64_t*)malloc(sizeof(*tss) * ARRAY_SIZE);
+  int32_t  *vs          = (int32_t*)malloc(sizeof(*vs) * ARRAY_SIZE);
+  SQLUSMALLINT *status  = (SQLUSMALLINT*)malloc(sizeof(*status) * ARRAY_SIZE);
+  SQLULEN nr_processed = 0;
+  do {
+    if (!tbnames || !tbname_lens || !ids || !tss || !vs || !status) {
+      E("out of memory");
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      snprintf(tbnames[i], sizeof(tbnames[i]), "s20_%zd", i % NR_SUBTBLS);
+      tbname_lens[i] = SQL_NTS;
+      ids[i] = (int32_t)(i % NR_SUBTBLS);
+      tss[i] = 1665551655000 + (int64_t)(i / NR_SUBTBLS);
+      vs[i]  = (int32_t)i;
+      status[i] = SQL_PARAM_UNUSED;
+    }
+
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into ? using s20 tags (?) values (?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(tbnames[0]), 0, tbnames[0], sizeof(tbnames[0]), tbname_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, ids, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 4, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, vs, 0, NULL);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      if (status[i] != SQL_PARAM_SUCCESS) {
+        E("param #%zd:SQL_PARAM_SUCCESS expected, but got ==%d==", i+1, status[i]);
+        r = -1;
+        break;
+      }
+    }
+    if (r) break;
+
+    for (size_t i=0; i<NR_SUBTBLS; ++i) {
+      char sql[128];
+      const int64_t nr_rows = ARRAY_SIZE / NR_SUBTBLS;
+      int64_t count = 0;
+      int64_t sum = 0;
+      snprintf(sql, sizeof(sql), "select count(*) from s20_%zd", i);
+      r = _exec_and_get_sbigint(hconn, sql, &count);
+      if (r) break;
+      snprintf(sql, sizeof(sql), "select sum(v) from s20_%zd", i);
+      r = _exec_and_get_sbigint(hconn, sql, &sum);
+      if (r) break;
+      if (count != nr_rows || sum != nr_rows * (int64_t)i + NR_SUBTBLS * nr_rows * (nr_rows - 1) / 2) {
+        E("s20_%zd:unexpected count/sum, got ==%" PRId64 "/%" PRId64 "==", i, count, sum);
+        r = -1;
+        break;
+      }
+    }
+  } while (0);
+#undef ARRAY_SIZE
+#undef NR_SUBTBLS
+
+  free(tbnames);
+  free(tbname_lens);
+  free(ids);
+  free(tss);
+  free(vs);
+  free(status);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case21(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t21",
+    "create table t21 (ts timestamp, i8 tinyint, i16 smallint, i32 int, i64 bigint, f float, d double, b bool, s varchar(16), c int)",
+    "insert into t21 values (1665551655000, -1, 0, 0, 0, 0.5, 0.25, false, 's0', 0)",
+    "insert into t21 values (1665551655001, 0, 100, 1000, 10000000000, 1.5, 1.25, true, 's1', 7)",
+    "insert into t21 values (1665551655002, 1, 200, 2000, 20000000000, 2.5, 2.25, false, 's2', 14)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 2
+  // NOTE: every column takes the planned copy, but c which is converted to SQL_C_CHAR by the generic path
+  SQL_TIMESTAMP_STRUCT  tss[ARRAY_SIZE];
+  int8_t                i8s[ARRAY_SIZE];
+  int16_t               i16s[ARRAY_SIZE];
+  int32_t               i32s[ARRAY_SIZE];
+  int64_t               i64s[ARRAY_SIZE];
+  float                 fs[ARRAY_SIZE];
+  double                ds[ARRAY_SIZE];
+  unsigned char         bs[ARRAY_SIZE];
+  char                  ss[ARRAY_SIZE][17];
+  char                  cs[ARRAY_SIZE][12];
+  SQLLEN                inds[10][ARRAY_SIZE];
+  SQLULEN               nr_fetched = 0;
+  size_t                i_row = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &nr_fetched, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select * from t21 order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindCol(hstmt, 1, SQL_C_TYPE_TIMESTAMP, tss, sizeof(tss[0]), inds[0]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 2, SQL_C_STINYINT, i8s, sizeof(i8s[0]), inds[1]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 3, SQL_C_SSHORT, i16s, sizeof(i16s[0]), inds[2]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 4, SQL_C_SLONG, i32s, sizeof(i32s[0]), inds[3]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 5, SQL_C_SBIGINT, i64s, sizeof(i64s[0]), inds[4]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 6, SQL_C_FLOAT, fs, sizeof(fs[0]), inds[5]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 7, SQL_C_DOUBLE, ds, sizeof(ds[0]), inds[6]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 8, SQL_C_BIT, bs, sizeof(bs[0]), inds[7]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 9, SQL_C_CHAR, ss, sizeof(ss[0]), inds[8]);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 10, SQL_C_CHAR, cs, sizeof(cs[0]), inds[9]);
+    if (FAILED(sr)) break;
+
+    while (1) {
+      sr = CALL_SQLFetch(hstmt);
+      if (sr == SQL_NO_DATA) {
+        sr = SQL_SUCCESS;
+        break;
+      }
+      if (FAILED(sr)) break;
+
+      for (size_t i=0; i<nr_fetched; ++i, ++i_row) {
+        char s[17], c[12];
+        snprintf(s, sizeof(s), "s%zd", i_row);
+        snprintf(c, sizeof(c), "%zd", 7 * i_row);
+        if (tss[i].fraction != (SQLUINTEGER)i_row * 1000000
+            || i8s[i] != (int8_t)i_row - 1 || i16s[i] != (int16_t)(100 * i_row)
+            || i32s[i] != (int32_t)(1000 * i_row) || i64s[i] != (int64_t)10000000000 * (int64_t)i_row
+            || fs[i] != (float)i_row + 0.5f || ds[i] != (double)i_row + 0.25
+            || bs[i] != (i_row % 2) || strcmp(ss[i], s) || strcmp(cs[i], c))
+        {
+          E("t21:row #%zd:unexpected values", i_row + 1);
+          r = -1;
+          break;
+        }
+      }
+      if (r) break;
+    }
+    if (r || FAILED(sr)) break;
+
+    if (i_row != 3) {
+      E("t21:3 rows expected, but got ==%zd==", i_row);
+      r = -1;
+      break;
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case22(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  // NOTE: ten million filled windows around the rows of s16, which takes the server well beyond 1 second
+  const char *sql =
+    "select count(*) from ("
+    "select _wstart, count(*) from s16 where ts >= 1665546655000 and ts < 1665556655000 interval(1a) fill(value, 0)"
+    ")";
+
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER)1, 0);
+    if (FAILED(sr)) break;
+    // NOTE: websocket backend does not honor SQL_ATTR_QUERY_TIMEOUT
+    if (sr == SQL_SUCCESS_WITH_INFO) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)sql, SQL_NTS);
+    if (sr != SQL_ERROR) {
+      E("SQL_ERROR expected, but got ==%s==", sql_return_type(sr));
+      r = -1;
+      break;
+    }
+    sr = SQL_SUCCESS;
+    r = _check_sqlstate(SQL_HANDLE_STMT, hstmt, "HYT00");
+    if (r) break;
+
+    // NOTE: only the timed-out query is killed, the connection is still usable
+    int64_t count = 0;
+    r = _exec_and_get_sbigint(hconn, "select count(*) from t17", &count);
+    if (r) break;
+    if (count != 8) {
+      E("t17:8 rows expected, but got ==%" PRId64 "==", count);
+      r = -1;
+      break;
+    }
+  } while (0);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+typedef struct test_case23_arg_s           test_case23_arg_t;
+struct test_case23_arg_s {
+  SQLHANDLE             hstmt;
+  pthread_mutex_t       mutex;
+  pthread_cond_t        cond;
+  int                   done;
+};
+
+static void* _test_case23_canceller(void *arg)
+{
+  test_case23_arg_t *ctx = (test_case23_arg_t*)arg;
+
+  // NOTE: cancelling before the execute starts is a no-op, thus keep cancelling every 200ms till it's done
+  pthread_mutex_lock(&ctx->mutex);
+  while (!ctx->done) {
+    struct timespec abstime = {0};
+    struct timeval now = {0};
+    gettimeofday(&now, NULL);
+    int64_t deadline = (int64_t)now.tv_sec * 1000 + now.tv_usec / 1000 + 200;
+    abstime.tv_sec  = (time_t)(deadline / 1000);
+    abstime.tv_nsec = (long)(deadline % 1000) * 1000000;
+    pthread_cond_timedwait(&ctx->cond, &ctx->mutex, &abstime);
+    if (ctx->done) break;
+    pthread_mutex_unlock(&ctx->mutex);
+    CALL_SQLCancel(ctx->hstmt);
+    pthread_mutex_lock(&ctx->mutex);
+  }
+  pthread_mutex_unlock(&ctx->mutex);
+
+  return NULL;
+}
+
+static int test_case23(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  // NOTE: same slow query as test_case22
+  const char *sql =
+    "select count(*) from ("
+    "select _wstart, count(*) from s16 where ts >= 1665546655000 and ts < 1665556655000 interval(1a) fill(value, 0)"
+    ")";
+
+  test_case23_arg_t ctx = {0};
+  ctx.hstmt = hstmt;
+  pthread_mutex_init(&ctx.mutex, NULL);
+  pthread_cond_init(&ctx.cond, NULL);
+
+  pthread_t canceller;
+  if (pthread_create(&canceller, NULL, _test_case23_canceller, &ctx)) {
+    E("pthread_create failed");
+    r = -1;
+  } else {
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)sql, SQL_NTS);
+
+    pthread_mutex_lock(&ctx.mutex);
+    ctx.done = 1;
+    pthread_cond_signal(&ctx.cond);
+    pthread_mutex_unlock(&ctx.mutex);
+    pthread_join(canceller, NULL);
+
+    do {
+      if (sr != SQL_ERROR) {
+        E("SQL_ERROR expected, but got ==%s==", sql_return_type(sr));
+        r = -1;
+        break;
+      }
+      sr = SQL_SUCCESS;
+      r = _check_sqlstate(SQL_HANDLE_STMT, hstmt, "HY008");
+      if (r) break;
+
+      // NOTE: cancelled state does not stick to the statement
+      sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select count(*) from t17", SQL_NTS);
+      if (FAILED(sr)) break;
+      sr = CALL_SQLFetch(hstmt);
+      if (FAILED(sr)) break;
+      int64_t count = 0;
+      sr = CALL_SQLGetData(hstmt, 1, SQL_C_SBIGINT, &count, sizeof(count), NULL);
+      if (FAILED(sr)) break;
+      if (count != 8) {
+        E("t17:8 rows expected, but got ==%" PRId64 "==", count);
+        r = -1;
+        break;
+      }
+    } while (0);
+  }
+
+  pthread_cond_destroy(&ctx.cond);
+  pthread_mutex_destroy(&ctx.mutex);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int _test_case24_insert(SQLHANDLE hconn, const char *sql, int64_t ts, int32_t v)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)sql, SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, &ts, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, &v, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+  } while (0);
+
+  // NOTE: parks the prepared insert in the connection cache
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return FAILED(sr) ? -1 : 0;
+}
+
+static int test_case24(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t24",
+    "create table t24 (ts timestamp, v int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  const char *sql = "insert into t24 (ts, v) values (?, ?)";
+
+  SQLULEN hits = 0;
+  SQLULEN misses = 0;
+  int64_t count = 0;
+  int64_t sum = 0;
+  do {
+    for (int i=0; i<3; ++i) {
+      r = _test_case24_insert(hconn, sql, 1665551655000 + i, i + 1);
+      if (r) break;
+      // NOTE: queries in between are never cached, thus neither hits nor misses
+      r = _exec_and_get_sbigint(hconn, "select count(*) from t24", &count);
+      if (r) break;
+    }
+    if (r) break;
+
+    sr = CALL_SQLGetConnectAttr(hconn, SQL_ATTR_TAOS_STMT_CACHE_HITS, &hits, sizeof(hits), NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLGetConnectAttr(hconn, SQL_ATTR_TAOS_STMT_CACHE_MISSES, &misses, sizeof(misses), NULL);
+    if (FAILED(sr)) break;
+    if (hits != 2 || misses != 1) {
+      E("STMT_CACHE:2 hits and 1 miss expected, but got ==%zd/%zd==", (size_t)hits, (size_t)misses);
+      r = -1;
+      break;
+    }
+
+    r = _exec_and_get_sbigint(hconn, "select count(*) from t24", &count);
+    if (r) break;
+    r = _exec_and_get_sbigint(hconn, "select sum(v) from t24", &sum);
+    if (r) break;
+    if (count != 3 || sum != 6) {
+      E("t24:unexpected count/sum, got ==%" PRId64 "/%" PRId64 "==", count, sum);
+      r = -1;
+      break;
+    }
+  } while (0);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case25(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop stable if exists s25",
+    "create stable s25 (ts timestamp, v int) tags (t int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  // NOTE: tags are sent only when they differ from the last ones sent, see _tags_memo_match
+  const struct {
+    const char     *tbname;
+    int32_t         t;
+    int32_t         v;
+    int             ts_null;    // rejected, after the tags have been set
+  } rows[] = {
+    {"s25_a", 1, 1, 0},
+    {"s25_a", 1, 2, 0},
+    {"s25_b", 2, 3, 0},
+    {"s25_c", 3, 4, 1},
+    {"s25_c", 3, 5, 0},
+    // NOTE: same subtbl with other tag values, thus set_tbname is re-issued along with set_tags,
+    //       the subtbl already exists, thus its tag is kept as created
+    {"s25_d", 4, 6, 0},
+    {"s25_d", 5, 7, 0},
+  };
+
+  char    tbname[8];
+  SQLLEN  tbname_len = SQL_NTS;
+  int32_t t = 0;
+  int64_t ts = 0;
+  SQLLEN  ts_ind = 0;
+  int32_t v = 0;
+  do {
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into ? using s25 tags (?) values (?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(tbname), 0, tbname, sizeof(tbname), &tbname_len);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, &t, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, &ts, 0, &ts_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 4, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, &v, 0, NULL);
+    if (FAILED(sr)) break;
+
+    for (size_t i=0; i<sizeof(rows)/sizeof(rows[0]); ++i) {
+      snprintf(tbname, sizeof(tbname), "%s", rows[i].tbname);
+      t      = rows[i].t;
+      ts     = 1665551655000 + (int64_t)i;
+      ts_ind = rows[i].ts_null ? SQL_NULL_DATA : 0;
+      v      = rows[i].v;
+      sr = CALL_SQLExecute(hstmt);
+      if (rows[i].ts_null) {
+        if (sr != SQL_ERROR) {
+          E("row #%zd:SQL_ERROR expected, but got ==%s==", i+1, sql_return_type(sr));
+          r = -1;
+          break;
+        }
+        sr = SQL_SUCCESS;
+        continue;
+      }
+      if (FAILED(sr)) break;
+    }
+    if (r || FAILED(sr)) break;
+
+    const struct {
+      const char     *tbname;
+      int64_t         t;
+      int64_t         count;
+      int64_t         sum;
+    } exps[] = {
+      {"s25_a", 1, 2, 3},
+      {"s25_b", 2, 1, 3},
+      {"s25_c", 3, 1, 5},
+      {"s25_d", 4, 2, 13},
+    };
+    for (size_t i=0; i<sizeof(exps)/sizeof(exps[0]); ++i) {
+      char sql[128];
+      int64_t tag = 0, count = 0, sum = 0;
+      snprintf(sql, sizeof(sql), "select t from %s limit 1", exps[i].tbname);
+      r = _exec_and_get_sbigint(hconn, sql, &tag);
+      if (r) break;
+      snprintf(sql, sizeof(sql), "select count(*) from %s", exps[i].tbname);
+      r = _exec_and_get_sbigint(hconn, sql, &count);
+      if (r) break;
+      snprintf(sql, sizeof(sql), "select sum(v) from %s", exps[i].tbname);
+      r = _exec_and_get_sbigint(hconn, sql, &sum);
+      if (r) break;
+      if (tag != exps[i].t || count != exps[i].count || sum != exps[i].sum) {
+        E("%s:tag/count/sum of %" PRId64 "/%" PRId64 "/%" PRId64 " expected, but got ==%" PRId64 "/%" PRId64 "/%" PRId64 "==",
+          exps[i].tbname, exps[i].t, exps[i].count, exps[i].sum, tag, count, sum);
+        r = -1;
+        break;
+      }
+    }
+  } while (0);
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int _test_case26_round(SQLHANDLE hconn, const conn_arg_t *conn_arg, SQLULEN hits_expected)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  char db[193];
+  SQLULEN hits = 0;
+
+  r = _driver_connect_with(hconn, conn_arg, "DB=foo;CONN_POOL=2");
+  if (r) return -1;
+
+  do {
+    sr = CALL_SQLGetConnectAttr(hconn, SQL_ATTR_TAOS_CONN_POOL_HITS, &hits, sizeof(hits), NULL);
+    if (FAILED(sr)) break;
+    if (hits != hits_expected) {
+      E("CONN_POOL:%zd hits expected, but got ==%zd==", (size_t)hits_expected, (size_t)hits);
+      r = -1;
+      break;
+    }
+
+    // NOTE: the pooled session must come back with the configured db, whatever it `use`d before
+    r = _exec_and_get_str(hconn, "select database()", db, sizeof(db));
+    if (r) break;
+    if (tod_strcasecmp(db, "foo")) {
+      E("CONN_POOL:current db `foo` expected, but got ==%s==", db);
+      r = -1;
+      break;
+    }
+
+    r = _exec_direct(hconn, "use bar26");
+    if (r) break;
+  } while (0);
+
+  CALL_SQLDisconnect(hconn);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case26(const conn_arg_t *conn_arg)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  SQLHANDLE henv = SQL_NULL_HANDLE;
+  SQLHANDLE hconn = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &henv);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLSetEnvAttr(henv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER)SQL_OV_ODBC3, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLAllocHandle(SQL_HANDLE_DBC, henv, &hconn);
+    if (FAILED(sr)) break;
+
+    r = _driver_connect_with(hconn, conn_arg, "DB=foo");
+    if (r) break;
+    r = _exec_direct(hconn, "create database if not exists bar26");
+    CALL_SQLDisconnect(hconn);
+    if (r) break;
+
+    // NOTE: the pool lives in the env, thus the second round reuses the handle parked by the first one
+    r = _test_case26_round(hconn, conn_arg, 0);
+    if (r) break;
+    r = _test_case26_round(hconn, conn_arg, 1);
+    if (r) break;
+  } while (0);
+
+  if (hconn) CALL_SQLFreeHandle(SQL_HANDLE_DBC, hconn);
+  CALL_SQLFreeHandle(SQL_HANDLE_ENV, henv);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int _get_meta_cache_counters(SQLHANDLE hconn, SQLULEN *hits, SQLULEN *misses)
+{
+  SQLRETURN sr = SQL_SUCCESS;
+
+  sr = CALL_SQLGetConnectAttr(hconn, SQL_ATTR_TAOS_META_CACHE_HITS, hits, sizeof(*hits), NULL);
+  if (FAILED(sr)) return -1;
+  sr = CALL_SQLGetConnectAttr(hconn, SQL_ATTR_TAOS_META_CACHE_MISSES, misses, sizeof(*misses), NULL);
+  if (FAILED(sr)) return -1;
+
+  return 0;
+}
+
+static int test_case27(const conn_arg_t *conn_arg)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sql = "select cast(1665551655000 as timestamp)";
+
+  SQLHANDLE henv = SQL_NULL_HANDLE;
+  SQLHANDLE hconn1 = SQL_NULL_HANDLE;
+  SQLHANDLE hconn2 = SQL_NULL_HANDLE;
+  int connected1 = 0;
+  int connected2 = 0;
+
+  SQLULEN hits1 = 0, misses1 = 0;
+  SQLULEN hits2 = 0, misses2 = 0;
+  char ts1[64];
+  char ts2[64];
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &henv);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLSetEnvAttr(henv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER)SQL_OV_ODBC3, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLAllocHandle(SQL_HANDLE_DBC, henv, &hconn1);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLAllocHandle(SQL_HANDLE_DBC, henv, &hconn2);
+    if (FAILED(sr)) break;
+
+    // NOTE: the first connection either fills the cache or hits an entry left by an earlier one
+    r = _driver_connect_with(hconn1, conn_arg, "DB=foo;META_CACHE_TTL=60");
+    if (r) break;
+    connected1 = 1;
+    r = _get_meta_cache_counters(hconn1, &hits1, &misses1);
+    if (r) break;
+
+    r = _driver_connect_with(hconn2, conn_arg, "DB=foo;META_CACHE_TTL=60");
+    if (r) break;
+    connected2 = 1;
+    r = _get_meta_cache_counters(hconn2, &hits2, &misses2);
+    if (r) break;
+    if (hits2 != hits1 + 1 || misses2 != misses1) {
+      E("META_CACHE_TTL:second connection expected to hit, but hits/misses went ==%zd/%zd== => ==%zd/%zd==",
+        (size_t)hits1, (size_t)misses1, (size_t)hits2, (size_t)misses2);
+      r = -1;
+      break;
+    }
+
+    // NOTE: the cached timezone must render timestamps the same as the queried one
+    r = _exec_and_get_str(hconn1, sql, ts1, sizeof(ts1));
+    if (r) break;
+    r = _exec_and_get_str(hconn2, sql, ts2, sizeof(ts2));
+    if (r) break;
+    if (strcmp(ts1, ts2)) {
+      E("META_CACHE_TTL:`%s` expected, but got ==%s==", ts1, ts2);
+      r = -1;
+      break;
+    }
+  } while (0);
+
+  if (connected2) CALL_SQLDisconnect(hconn2);
+  if (connected1) CALL_SQLDisconnect(hconn1);
+  if (hconn2) CALL_SQLFreeHandle(SQL_HANDLE_DBC, hconn2);
+  if (hconn1) CALL_SQLFreeHandle(SQL_HANDLE_DBC, hconn1);
+  CALL_SQLFreeHandle(SQL_HANDLE_ENV, henv);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case28(SQLHANDLE hconn, const conn_arg_t *conn_arg)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t28",
+    "create table t28 (ts timestamp, name nchar(10))",
+    "insert into t28 (ts, name) values (1665551655000, 'hello')",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE henv = SQL_NULL_HANDLE;
+  SQLHANDLE hlazy = SQL_NULL_HANDLE;
+  int connected = 0;
+
+  SQLULEN hits0 = 0, misses0 = 0;
+  SQLULEN hits1 = 0, misses1 = 0;
+  SQLULEN hits2 = 0, misses2 = 0;
+  char name[64];
+
+  r = _get_meta_cache_counters(hconn, &hits0, &misses0);
+  if (r) return -1;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &henv);
+  if (FAILED(sr)) return -1;
+
+  do {
+    sr = CALL_SQLSetEnvAttr(henv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER)SQL_OV_ODBC3, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLAllocHandle(SQL_HANDLE_DBC, henv, &hlazy);
+    if (FAILED(sr)) break;
+
+    // NOTE: META_CACHE_TTL is set only to observe when ins_configs is loaded, via the lookup counters
+    r = _driver_connect_with(hlazy, conn_arg, "DB=foo;LAZY_INIT=1;META_CACHE_TTL=60");
+    if (r) break;
+    connected = 1;
+
+    r = _get_meta_cache_counters(hlazy, &hits1, &misses1);
+    if (r) break;
+    if (hits1 + misses1 != hits0 + misses0) {
+      E("LAZY_INIT:no ins_configs lookup expected when connecting, but hits/misses went ==%zd/%zd== => ==%zd/%zd==",
+        (size_t)hits0, (size_t)misses0, (size_t)hits1, (size_t)misses1);
+      r = -1;
+      break;
+    }
+
+    r = _exec_and_get_str(hlazy, "select name from t28", name, sizeof(name));
+    if (r) break;
+    if (strcmp(name, "hello")) {
+      E("LAZY_INIT:`hello` expected, but got ==%s==", name);
+      r = -1;
+      break;
+    }
+
+    r = _get_meta_cache_counters(hlazy, &hits2, &misses2);
+    if (r) break;
+    if (hits2 + misses2 != hits1 + misses1 + 1) {
+      E("LAZY_INIT:exactly one ins_configs lookup expected by the first text statement, but hits/misses went ==%zd/%zd== => ==%zd/%zd==",
+        (size_t)hits1, (size_t)misses1, (size_t)hits2, (size_t)misses2);
+      r = -1;
+      break;
+    }
+
+    // NOTE: a successful lazy load leaves no diagnostics behind on the connection
+    SQLCHAR sqlState[6]; sqlState[0] = '\0';
+    SQLINTEGER nativeErrno = 0;
+    SQLCHAR messageText[1024]; messageText[0] = '\0';
+    SQLSMALLINT textLength = 0;
+    sr = SQLGetDiagRec(SQL_HANDLE_DBC, hlazy, 1, sqlState, &nativeErrno, messageText, sizeof(messageText), &textLength);
+    if (sr != SQL_NO_DATA) {
+      E("LAZY_INIT:no diagnostics expected on the connection, but got ==%s==:%s", (const char*)sqlState, (const char*)messageText);
+      sr = SQL_SUCCESS;
+      r = -1;
+      break;
+    }
+    sr = SQL_SUCCESS;
+  } while (0);
+
+  if (connected) CALL_SQLDisconnect(hlazy);
+  if (hlazy) CALL_SQLFreeHandle(SQL_HANDLE_DBC, hlazy);
+  CALL_SQLFreeHandle(SQL_HANDLE_ENV, henv);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case29(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop table if exists t29",
+    "create table t29 (ts timestamp, v int, name varchar(16))",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 10000
+  // NOTE: well beyond the 4096 rows of a taosc block, thus the fetch spans several prefetched blocks
+  int64_t  *tss         = (int64_t*)malloc(sizeof(*tss) * ARRAY_SIZE);
+  int32_t  *vs          = (int32_t*)malloc(sizeof(*vs) * ARRAY_SIZE);
+  char    (*names)[16]  = (char (*)[16])malloc(sizeof(*names) * ARRAY_SIZE);
+  SQLLEN   *name_lens   = (SQLLEN*)malloc(sizeof(*name_lens) * ARRAY_SIZE);
+  size_t nr_rows = 0;
+  do {
+    if (!tss || !vs || !names || !name_lens) {
+      E("out of memory");
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      tss[i] = 1665551655000 + (int64_t)i;
+      vs[i]  = (int32_t)i;
+      snprintf(names[i], sizeof(names[i]), "n%zd", i);
+      name_lens[i] = SQL_NTS;
+    }
+
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into t29 (ts, v, name) values (?, ?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, vs, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(names[0]), 0, names[0], sizeof(names[0]), name_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLExecute(hstmt);
+    if (FAILED(sr)) break;
+
+    CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+    hstmt = SQL_NULL_HANDLE;
+    sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+    if (FAILED(sr)) break;
+
+    int64_t ts = 0;
+    int32_t v = 0;
+    char name[16];
+    SQLLEN ts_ind = 0, v_ind = 0, name_ind = 0;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select ts, v, name from t29 order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 1, SQL_C_SBIGINT, &ts, sizeof(ts), &ts_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 2, SQL_C_SLONG, &v, sizeof(v), &v_ind);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 3, SQL_C_CHAR, name, sizeof(name), &name_ind);
+    if (FAILED(sr)) break;
+
+    // NOTE: every row is checked, a block overwritten by the in-flight fetch would show up as a mismatch
+    while (1) {
+      sr = CALL_SQLFetch(hstmt);
+      if (sr == SQL_NO_DATA) {
+        sr = SQL_SUCCESS;
+        break;
+      }
+      if (FAILED(sr)) break;
+      if (nr_rows >= ARRAY_SIZE) {
+        E("t29:%d rows expected, but got more", ARRAY_SIZE);
+        r = -1;
+        break;
+      }
+      if (ts != tss[nr_rows] || v != vs[nr_rows] || strcmp(name, names[nr_rows])) {
+        E("t29:row #%zd:`%" PRId64 "/%d/%s` expected, but got ==%" PRId64 "/%d/%s==",
+          nr_rows + 1, tss[nr_rows], vs[nr_rows], names[nr_rows], ts, v, name);
+        r = -1;
+        break;
+      }
+      ++nr_rows;
+    }
+    if (r || FAILED(sr)) break;
+
+    if (nr_rows != ARRAY_SIZE) {
+      E("t29:%d rows expected, but got ==%zd==", ARRAY_SIZE, nr_rows);
+      r = -1;
+      break;
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  free(tss);
+  free(vs);
+  free(names);
+  free(name_lens);
+
+  if (hstmt) CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case30(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  const char *sqls[] = {
+    "drop stable if exists s30",
+    "create stable s30 (ts timestamp, v int) tags (id int)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+#define ARRAY_SIZE 6
+  // NOTE: interleaved subtbls, the 4th one without a name, which alone is expected to be rejected
+  char      tbnames[ARRAY_SIZE][8]   = {"s30_a", "s30_b", "s30_a", "", "s30_b", "s30_a"};
+  SQLLEN    tbname_lens[ARRAY_SIZE]  = {SQL_NTS, SQL_NTS, SQL_NTS, SQL_NULL_DATA, SQL_NTS, SQL_NTS};
+  int32_t   ids[ARRAY_SIZE]          = {1, 2, 1, 3, 2, 1};
+  int64_t   tss[ARRAY_SIZE]          = {1665551655000, 1665551655000, 1665551655001, 1665551655000, 1665551655001, 1665551655002};
+  int32_t   vs[ARRAY_SIZE]           = {1, 10, 2, 100, 20, 3};
+  SQLUSMALLINT status[ARRAY_SIZE]    = {0};
+  SQLULEN nr_processed = 0;
+  const SQLUSMALLINT exps[ARRAY_SIZE] = {
+    SQL_PARAM_SUCCESS, SQL_PARAM_SUCCESS, SQL_PARAM_SUCCESS, SQL_PARAM_ERROR, SQL_PARAM_SUCCESS, SQL_PARAM_SUCCESS,
+  };
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)ARRAY_SIZE, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_processed, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)"insert into ? using s30 tags (?) values (?, ?)", SQL_NTS);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLBindParameter(hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, sizeof(tbnames[0]), 0, tbnames[0], sizeof(tbnames[0]), tbname_lens);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 2, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, ids, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 3, SQL_PARAM_INPUT, SQL_C_SBIGINT, SQL_TYPE_TIMESTAMP, 23, 3, tss, 0, NULL);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindParameter(hstmt, 4, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER, 0, 0, vs, 0, NULL);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecute(hstmt);
+    if (sr != SQL_SUCCESS_WITH_INFO) {
+      E("SQL_SUCCESS_WITH_INFO expected, but got ==%s==", sql_return_type(sr));
+      sr = SQL_SUCCESS;
+      r = -1;
+      break;
+    }
+    sr = SQL_SUCCESS;
+
+    if (nr_processed != ARRAY_SIZE) {
+      E("%d params processed expected, but got ==%zd==", ARRAY_SIZE, (size_t)nr_processed);
+      r = -1;
+      break;
+    }
+    for (size_t i=0; i<ARRAY_SIZE; ++i) {
+      if (status[i] != exps[i]) {
+        E("param #%zd:%d expected, but got ==%d==", i+1, exps[i], status[i]);
+        r = -1;
+        break;
+      }
+    }
+    if (r) break;
+
+    int64_t count = 0;
+    int64_t sum = 0;
+    r = _exec_and_get_sbigint(hconn, "select count(*) from s30_a", &count);
+    if (r) break;
+    r = _exec_and_get_sbigint(hconn, "select sum(v) from s30_a", &sum);
+    if (r) break;
+    if (count != 3 || sum != 6) {
+      E("s30_a:count/sum of 3/6 expected, but got ==%" PRId64 "/%" PRId64 "==", count, sum);
+      r = -1;
+      break;
+    }
+    r = _exec_and_get_sbigint(hconn, "select count(*) from s30_b", &count);
+    if (r) break;
+    r = _exec_and_get_sbigint(hconn, "select sum(v) from s30_b", &sum);
+    if (r) break;
+    if (count != 2 || sum != 30) {
+      E("s30_b:count/sum of 2/30 expected, but got ==%" PRId64 "/%" PRId64 "==", count, sum);
+      r = -1;
+      break;
+    }
+  } while (0);
+#undef ARRAY_SIZE
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_case31(SQLHANDLE hconn)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+
+  // NOTE: nulls scattered across columns of one block, see taos_is_null_by_column
+  const char *sqls[] = {
+    "drop table if exists t31",
+    "create table t31 (ts timestamp, v int, s varchar(8))",
+    "insert into t31 (ts, v, s) values (1665551655000, 0, 'a')"
+                                    " (1665551655001, null, 'b')"
+                                    " (1665551655002, 2, null)"
+                                    " (1665551655003, null, null)"
+                                    " (1665551655004, 4, 'e')"
+                                    " (1665551655005, 5, null)",
+  };
+
+  r = _prepare_dataset_conn(hconn, sqls, sizeof(sqls)/sizeof(sqls[0]));
+  if (r) return -1;
+
+#define NR_ROWS 6
+  const int v_nulls[NR_ROWS] = {0, 1, 0, 1, 0, 0};
+  const int s_nulls[NR_ROWS] = {0, 0, 1, 1, 0, 1};
+
+  SQLHANDLE hstmt = SQL_NULL_HANDLE;
+
+  sr = CALL_SQLAllocHandle(SQL_HANDLE_STMT, hconn, &hstmt);
+  if (FAILED(sr)) return -1;
+
+  int32_t vs[NR_ROWS];
+  SQLLEN  v_inds[NR_ROWS];
+  char    ss[NR_ROWS][8];
+  SQLLEN  s_inds[NR_ROWS];
+  SQLULEN nr_rows = 0;
+  do {
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)NR_ROWS, 0);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &nr_rows, 0);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)"select v, s from t31 order by ts", SQL_NTS);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 1, SQL_C_SLONG, vs, sizeof(vs[0]), v_inds);
+    if (FAILED(sr)) break;
+    sr = CALL_SQLBindCol(hstmt, 2, SQL_C_CHAR, ss[0], sizeof(ss[0]), s_inds);
+    if (FAILED(sr)) break;
+
+    sr = CALL_SQLFetch(hstmt);
+    if (FAILED(sr)) break;
+    if (nr_rows != NR_ROWS) {
+      E("t31:%d rows expected, but got ==%zd==", NR_ROWS, (size_t)nr_rows);
+      r = -1;
+      break;
+    }
+
+    for (size_t i=0; i<NR_ROWS; ++i) {
+      if ((v_inds[i] == SQL_NULL_DATA) != v_nulls[i] || (s_inds[i] == SQL_NULL_DATA) != s_nulls[i]) {
+        E("t31:row #%zd:null flags of %d/%d expected, but got ==%d/%d==",
+          i+1, v_nulls[i], s_nulls[i], v_inds[i] == SQL_NULL_DATA, s_inds[i] == SQL_NULL_DATA);
+        r = -1;
+        break;
+      }
+      if (!v_nulls[i] && vs[i] != (int32_t)i) {
+        E("t31:row #%zd:v of %zd expected, but got ==%d==", i+1, i, vs[i]);
+        r = -1;
+        break;
+      }
+      if (!s_nulls[i] && (ss[i][0] != 'a' + (char)i || ss[i][1])) {
+        E("t31:row #%zd:s of `%c` expected, but got ==%s==", i+1, 'a' + (char)i, ss[i]);
+        r = -1;
+        break;
+      }
+    }
+  } while (0);
+#undef NR_ROWS
+
+  CALL_SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+
+  return (r || FAILED(sr)) ? -1 : 0;
+}
+
+static int test_bind_params_with_stmt(SQLHANDLE hconn, SQLHANDLE hstmt)
+{
+  int r = 0;
+  SQLRETURN sr = SQL_SUCCESS;
+  char buf[1024];
+  simple_str_t str = {
+    .base           = buf,
+    .cap            = sizeof(buf),
+    .nr             = 0,
+  };
+
+  const char *database = "foo";
+
+  if (_under_taos_mysql_sqlite3 != 2) {
+    r = _exec_(hstmt, "drop database if exists %s", database);
+    if (r) return -1;
+    r = _exec_(hstmt, "create database if not exists %s", database);
+    if (r) return -1;
+    r = _exec_(hstmt, "use %s", database);
+    if (r) return -1;
+  }
+
+  const char *table = "t";
+  field_t fields[] = {
+    {"ts", "timestamp"},
+    {"vname", "varchar(10)"},
+    {"wname", "nchar(10)"},
+    {"bi", "bigint"},
+  };
+  if (_under_taos_mysql_sqlite3) {
+    fields[0].field = "bigint";
+  }
+
+  r = _exec_(hstmt, "drop table if exists %s", table);
+  if (r) return -1;
+
+  r = _gen_table_create_sql(&str, table, fields, sizeof(fields)/sizeof(fields[0]));
+  if (r) return -1;
+  sr = CALL_SQLExecDirect(hstmt, (SQLCHAR*)buf, SQL_NTS);
+  if (sr == SQL_ERROR) return -1;
+
+#define ARRAY_SIZE 10
+
+  SQLUSMALLINT param_status_arr[ARRAY_SIZE] = {0};
+  SQLULEN nr_params_processed = 0;
+  int64_t ts_arr[ARRAY_SIZE] = {1662861448751};
+  SQLLEN  ts_ind[ARRAY_SIZE] = {0};
+  char    varchar_arr[ARRAY_SIZE][100];
+  SQLLEN  varchar_ind[ARRAY_SIZE] = {0};
+  char    nchar_arr[ARRAY_SIZE][100];
+  SQLLEN  nchar_ind[ARRAY_SIZE] = {0};
+  int64_t i64_arr[ARRAY_SIZE] = {1662861448751};
+  SQLLEN  i64_ind[ARRAY_SIZE] = {0};
+
+  const param_t params[] = {
+    {SQL_PARAM_INPUT,  SQL_C_SBIGINT,  SQL_TYPE_TIMESTAMP,  23,       3,          ts_arr,           0,   ts_ind},
+    {SQL_PARAM_INPUT,  SQL_C_CHAR,     SQL_VARCHAR,         99,       0,          varchar_arr,      100, varchar_ind},
+    {SQL_PARAM_INPUT,  SQL_C_CHAR,     SQL_WVARCHAR,        99,       0,          nchar_arr,        100, nchar_ind},
+    {SQL_PARAM_INPUT,  SQL_C_SBIGINT,  SQL_BIGINT,          99,       0,          i64_arr,          100, i64_ind},
+  };
+
+  SQLULEN nr_paramset_size = 4;
+
+  for (int i=0; i<ARRAY_SIZE; ++i) {
+    ts_arr[i] = 1662861448751 + i;
+    snprintf(varchar_arr[i], 100, "a人%d", i);
+    varchar_ind[i] = SQL_NTS;
+    snprintf(nchar_arr[i], 100, "b民%d", i);
+    nchar_ind[i] = SQL_NTS;
+    i64_arr[i] = 54321 + i;
+  }
+
+  str.nr = 0;
+  r = _gen_table_param_insert(&str, table, fields, sizeof(fields)/sizeof(fields[0]));
+  if (r) return -1;
+
+  sr = CALL_SQLPrepare(hstmt, (SQLCHAR*)buf, SQL_NTS);
+  if (sr == SQL_ERROR) return -1;
+
+  // Set the SQL_ATTR_PARAM_BIND_TYPE statement attribute to use
+  // column-wise binding.
+  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_BIND_TYPE, SQL_PARAM_BIND_BY_COLUMN, 0);
+
+  // Specify the number of elements in each parameter array.
+  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)(uintptr_t)nr_paramset_size, 0);
+
+  // Specify an array in which to return the status of each set of
+  // parameters.
+  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, param_status_arr, 0);
+
+  // Specify an SQLUINTEGER value in which to return the number of sets of
+  // parameters processed.
+  CALL_SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &nr_params_processed, 0);
+
+  // Bind the parameters in column-wise fashion.
+  for (size_t i=0; i<sizeof(params)/sizeof(params[0]); ++i) {
+    const param_t *param = params + i;
+    sr = CALL_SQLBindParameter(hstmt, (SQLUSMALLINT)i+1,
+        param->InputOutputType,
+        param->ValueType,
+        param->ParameterType,
+        param->ColumnSize,
+        param->DecimalDigits,
+        param->ParameterValuePtr,
+        param->BufferLength,
+        param->StrLen_or_IndPtr);
+    if (sr == SQL_ERROR) return -1;
+  }
+
+
+  // Set part ID, description, and price.
+
+  // Execute the statement.
+  sr = CALL_SQLExecute(hstmt);
+  if (sr == SQL_ERROR) return -1;
 
   if (nr_params_processed != nr_paramset_size) {
     W("%zu rows of params to be processed, but only %zu", nr_paramset_size, nr_params_processed);
@@ -2330,11 +4408,11 @@ static int test_cases(SQLHANDLE hconn, conn_arg_t *conn_arg)
 
   int non_taos = 0;
 
-  r = test_case4(hconn, non_taos, 128, 113);
+  r = test_case4(hconn, 128, 113);
   if (r) return r;
 
   if (0 && !non_taos) {
-    r = test_case4(hconn, non_taos, 5000, 4000);
+    r = test_case4(hconn, 5000, 4000);
     if (r) return r;
   }
 
@@ -2353,6 +4431,82 @@ static int test_cases(SQLHANDLE hconn, conn_arg_t *conn_arg)
   r = test_case9(hconn);
   if (r) return r;
 
+  r = test_case10(hconn);
+  if (r) return r;
+
+  r = test_case11(hconn);
+  if (r) return r;
+
+  if (!non_taos) {
+    r = test_case12(hconn);
+    if (r) return r;
+
+    r = test_case13(hconn);
+    if (r) return r;
+
+    r = test_case14(hconn);
+    if (r) return r;
+
+    r = test_case15(hconn);
+    if (r) return r;
+
+    r = test_case16(hconn);
+    if (r) return r;
+
+    r = test_case17(hconn);
+    if (r) return r;
+
+    r = test_case18(hconn);
+    if (r) return r;
+
+    r = test_case19(hconn);
+    if (r) return r;
+
+    r = _run_with_conn(conn_arg, "DB=foo;PARALLEL_INSERT=4", test_case20);
+    if (r) return r;
+
+    r = test_case21(hconn);
+    if (r) return r;
+
+    r = test_case22(hconn);
+    if (r) return r;
+
+    if (!conn_arg->ws) {
+      r = test_case23(hconn);
+      if (r) return r;
+    }
+
+    if (!conn_arg->ws) {
+      r = _run_with_conn(conn_arg, "DB=foo;STMT_CACHE=4", test_case24);
+      if (r) return r;
+    }
+
+    r = test_case25(hconn);
+    if (r) return r;
+
+    if (!conn_arg->ws) {
+      r = test_case26(conn_arg);
+      if (r) return r;
+    }
+
+    r = test_case27(conn_arg);
+    if (r) return r;
+
+    r = test_case28(hconn, conn_arg);
+    if (r) return r;
+
+    if (!conn_arg->ws) {
+      r = _run_with_conn(conn_arg, "DB=foo;PREFETCH=1", test_case29);
+      if (r) return r;
+    }
+
+    r = test_case30(hconn);
+    if (r) return r;
+
+    r = test_case31(hconn);
+    if (r) return r;
+  }
+
   return r;
 }
 